@@ -44,6 +44,7 @@ public class ALSV4_CPP : ModuleRules
 				"CommonUser",
 				"CommonUI",
 				"GameplayMessageRuntime",
+				"Json",
 				"Slate",
 				"SlateCore"
 			}
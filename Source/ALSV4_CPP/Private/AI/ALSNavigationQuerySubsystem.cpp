@@ -0,0 +1,118 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#include "AI/ALSNavigationQuerySubsystem.h"
+
+#include "Engine/World.h"
+#include "NavFilters/NavigationQueryFilter.h"
+
+static TAutoConsoleVariable<int32> CVarRandomLocationQueriesPerFrame(
+	TEXT("ALS.AI.RandomLocationQueriesPerFrame"),
+	8,
+	TEXT("Maximum number of random location navigation queries serviced per frame."),
+	ECVF_Default);
+
+UALSNavigationQuerySubsystem* UALSNavigationQuerySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UALSNavigationQuerySubsystem>() : nullptr;
+}
+
+void UALSNavigationQuerySubsystem::Deinitialize()
+{
+	PendingQueries.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UALSNavigationQuerySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UALSNavigationQuerySubsystem, STATGROUP_Tickables);
+}
+
+void UALSNavigationQuerySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingQueries.Num() == 0)
+	{
+		return;
+	}
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const int32 NumToService = FMath::Min(PendingQueries.Num(),
+	                                      FMath::Max(1, CVarRandomLocationQueriesPerFrame.GetValueOnGameThread()));
+
+	// Move this frame's batch out first, the finish delegates are allowed to queue new queries
+	TArray<FPendingQuery, TInlineAllocator<16>> Batch;
+	Batch.Reserve(NumToService);
+	for (int32 Index = 0; Index < NumToService; ++Index)
+	{
+		Batch.Add(MoveTemp(PendingQueries[Index]));
+	}
+	PendingQueries.RemoveAt(0, NumToService, false);
+
+	for (FPendingQuery& Query : Batch)
+	{
+		if (NavSys)
+		{
+			ServiceQuery(*NavSys, Query);
+		}
+		else
+		{
+			Query.OnFinished.ExecuteIfBound(Query.QueryId, false, Query.Origin);
+		}
+	}
+}
+
+void UALSNavigationQuerySubsystem::ServiceQuery(UNavigationSystemV1& NavSys, FPendingQuery& Query)
+{
+	FSharedConstNavQueryFilter SharedFilter = nullptr;
+	if (Query.Filter)
+	{
+		const ANavigationData* NavData = NavSys.GetDefaultNavDataInstance(FNavigationSystem::DontCreate);
+		if (NavData)
+		{
+			SharedFilter = UNavigationQueryFilter::GetQueryFilter(*NavData, GetWorld(), Query.Filter);
+		}
+	}
+
+	FNavLocation Destination;
+	const bool bSuccess = NavSys.GetRandomReachablePointInRadius(Query.Origin, Query.Radius, Destination, nullptr,
+	                                                             SharedFilter);
+
+	Query.OnFinished.ExecuteIfBound(Query.QueryId, bSuccess, bSuccess ? Destination.Location : Query.Origin);
+}
+
+uint32 UALSNavigationQuerySubsystem::RequestRandomLocation(const AActor* Querier, const FVector& Origin, float Radius,
+                                                           TSubclassOf<UNavigationQueryFilter> Filter,
+                                                           FALSRandomLocationQueryFinished OnFinished)
+{
+	// Zero is reserved for "no query"
+	if (++LastQueryId == 0)
+	{
+		++LastQueryId;
+	}
+
+	FPendingQuery& Query = PendingQueries.AddDefaulted_GetRef();
+	Query.QueryId = LastQueryId;
+	Query.Querier = Querier;
+	Query.Origin = Origin;
+	Query.Radius = Radius;
+	Query.Filter = Filter;
+	Query.OnFinished = MoveTemp(OnFinished);
+	return Query.QueryId;
+}
+
+void UALSNavigationQuerySubsystem::CancelQuery(uint32 QueryId)
+{
+	const int32 Index = PendingQueries.IndexOfByPredicate([QueryId](const FPendingQuery& Query)
+	{
+		return Query.QueryId == QueryId;
+	});
+
+	if (Index != INDEX_NONE)
+	{
+		PendingQueries.RemoveAt(Index, 1, false);
+	}
+}
@@ -2,6 +2,7 @@
 // Source Code:     https://github.com/dyanikoglu/ALS-Community
 
 #include "AI/ALS_BTTask_GetRandomLocation.h"
+#include "AI/ALSNavigationQuerySubsystem.h"
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
@@ -9,17 +10,42 @@
 UALS_BTTask_GetRandomLocation::UALS_BTTask_GetRandomLocation()
 {
 	NodeName = "Get Random Location";
+	bNotifyTaskFinished = true;
 
 	BlackboardKey.AddVectorFilter(this, GET_MEMBER_NAME_CHECKED(UALS_BTTask_GetRandomLocation, BlackboardKey));
 }
 
 EBTNodeResult::Type UALS_BTTask_GetRandomLocation::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	APawn* Pawn = OwnerComp.GetAIOwner()->GetPawn();
+	if (!Pawn)
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	UALSNavigationQuerySubsystem* QuerySubsystem = UALSNavigationQuerySubsystem::Get(Pawn);
+	if (!bAsyncQuery || !QuerySubsystem)
+	{
+		return ExecuteSyncQuery(OwnerComp, Pawn);
+	}
+
+	const FVector Origin = Pawn->GetActorLocation();
+
+	FALSGetRandomLocationMemory* MyMemory = CastInstanceNodeMemory<FALSGetRandomLocationMemory>(NodeMemory);
+	MyMemory->QueryId = QuerySubsystem->RequestRandomLocation(
+		Pawn, Origin, MaxDistance, Filter,
+		FALSRandomLocationQueryFinished::CreateUObject(this, &UALS_BTTask_GetRandomLocation::OnQueryFinished,
+		                                               TWeakObjectPtr<UBehaviorTreeComponent>(&OwnerComp)));
+
+	return EBTNodeResult::InProgress;
+}
+
+EBTNodeResult::Type UALS_BTTask_GetRandomLocation::ExecuteSyncQuery(UBehaviorTreeComponent& OwnerComp, APawn* Pawn)
 {
 	UWorld* World = GetWorld();
 	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
-	APawn* Pawn = OwnerComp.GetAIOwner()->GetPawn();
 
-	if (NavSys && Pawn)
+	if (NavSys)
 	{
 		FSharedConstNavQueryFilter SharedFilter = nullptr;
 
@@ -45,8 +71,62 @@ EBTNodeResult::Type UALS_BTTask_GetRandomLocation::ExecuteTask(UBehaviorTreeComp
 	return EBTNodeResult::Failed;
 }
 
+void UALS_BTTask_GetRandomLocation::OnQueryFinished(uint32 QueryId, bool bSuccess, const FVector& Location,
+                                                    TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp)
+{
+	if (!OwnerComp.IsValid())
+	{
+		return;
+	}
+
+	uint8* NodeMemory = OwnerComp->GetNodeMemory(this, OwnerComp->FindInstanceContainingNode(this));
+	FALSGetRandomLocationMemory* MyMemory = CastInstanceNodeMemory<FALSGetRandomLocationMemory>(NodeMemory);
+	if (!MyMemory || MyMemory->QueryId != QueryId)
+	{
+		// Task was aborted or restarted in the meantime
+		return;
+	}
+
+	MyMemory->QueryId = 0;
+
+	if (bSuccess)
+	{
+		OwnerComp->GetBlackboardComponent()->SetValueAsVector(BlackboardKey.SelectedKeyName, Location);
+	}
+
+	FinishLatentTask(*OwnerComp, bSuccess ? EBTNodeResult::Succeeded : EBTNodeResult::Failed);
+}
+
+EBTNodeResult::Type UALS_BTTask_GetRandomLocation::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	// Pending query gets dropped in OnTaskFinished
+	return EBTNodeResult::Aborted;
+}
+
+void UALS_BTTask_GetRandomLocation::OnTaskFinished(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory,
+                                                   EBTNodeResult::Type TaskResult)
+{
+	FALSGetRandomLocationMemory* MyMemory = CastInstanceNodeMemory<FALSGetRandomLocationMemory>(NodeMemory);
+	if (MyMemory->QueryId != 0)
+	{
+		if (UALSNavigationQuerySubsystem* QuerySubsystem = UALSNavigationQuerySubsystem::Get(&OwnerComp))
+		{
+			QuerySubsystem->CancelQuery(MyMemory->QueryId);
+		}
+		MyMemory->QueryId = 0;
+	}
+
+	Super::OnTaskFinished(OwnerComp, NodeMemory, TaskResult);
+}
+
+uint16 UALS_BTTask_GetRandomLocation::GetInstanceMemorySize() const
+{
+	return sizeof(FALSGetRandomLocationMemory);
+}
+
 FString UALS_BTTask_GetRandomLocation::GetStaticDescription() const
 {
-	return FString::Printf(TEXT("Get Random Location\nMax Distance: %d\nFilter:%s"), FMath::RoundToInt(MaxDistance),
-	                       Filter ? *GetNameSafe(Filter.Get()) : TEXT("None"));
+	return FString::Printf(TEXT("Get Random Location\nMax Distance: %d\nFilter:%s%s"), FMath::RoundToInt(MaxDistance),
+	                       Filter ? *GetNameSafe(Filter.Get()) : TEXT("None"),
+	                       bAsyncQuery ? TEXT("\nAsync") : TEXT(""));
 }
@@ -42,6 +42,9 @@ void UALSAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AAct
 
 	Super::InitAbilityActorInfo(InOwnerActor, InAvatarActor);
 
+	// The cached dynamic tag spec's context points at the previous avatar
+	DynamicTagSpecTemplate.Clear();
+
 	if (bHasNewPawnAvatar)
 	{
 		// Notify all abilities that a new pawn avatar has been set
@@ -176,12 +179,13 @@ void UALSAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& Inpu
 {
 	if (InputTag.IsValid())
 	{
-		for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+		for (TMultiMap<FGameplayTag, FGameplayAbilitySpecHandle>::TConstKeyIterator It(InputTagToSpecHandles, InputTag); It; ++It)
 		{
-			if (AbilitySpec.Ability && (AbilitySpec.DynamicAbilityTags.HasTagExact(InputTag)))
+			const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(It.Value());
+			if (AbilitySpec && AbilitySpec->Ability && (AbilitySpec->DynamicAbilityTags.HasTagExact(InputTag)))
 			{
-				InputPressedSpecHandles.AddUnique(AbilitySpec.Handle);
-				InputHeldSpecHandles.AddUnique(AbilitySpec.Handle);
+				InputPressedSpecHandles.AddUnique(AbilitySpec->Handle);
+				InputHeldSpecHandles.AddUnique(AbilitySpec->Handle);
 			}
 		}
 	}
@@ -191,17 +195,91 @@ void UALSAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTag& Inp
 {
 	if (InputTag.IsValid())
 	{
-		for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+		for (TMultiMap<FGameplayTag, FGameplayAbilitySpecHandle>::TConstKeyIterator It(InputTagToSpecHandles, InputTag); It; ++It)
 		{
-			if (AbilitySpec.Ability && (AbilitySpec.DynamicAbilityTags.HasTagExact(InputTag)))
+			const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(It.Value());
+			if (AbilitySpec && AbilitySpec->Ability && (AbilitySpec->DynamicAbilityTags.HasTagExact(InputTag)))
 			{
-				InputReleasedSpecHandles.AddUnique(AbilitySpec.Handle);
-				InputHeldSpecHandles.Remove(AbilitySpec.Handle);
+				InputReleasedSpecHandles.AddUnique(AbilitySpec->Handle);
+				InputHeldSpecHandles.Remove(AbilitySpec->Handle);
 			}
 		}
 	}
 }
 
+void UALSAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+
+	AddToAbilityInputIndex(AbilitySpec);
+}
+
+void UALSAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	RemoveFromAbilityInputIndex(AbilitySpec);
+
+	Super::OnRemoveAbility(AbilitySpec);
+}
+
+void UALSAbilitySystemComponent::AddToAbilityInputIndex(const FGameplayAbilitySpec& AbilitySpec)
+{
+	for (const FGameplayTag& Tag : AbilitySpec.DynamicAbilityTags)
+	{
+		InputTagToSpecHandles.AddUnique(Tag, AbilitySpec.Handle);
+	}
+
+	// The spec normally lives in ActivatableAbilities already, so its index is free to compute
+	const int32 SpecIndex = &AbilitySpec - ActivatableAbilities.Items.GetData();
+	if (ActivatableAbilities.Items.IsValidIndex(SpecIndex))
+	{
+		SpecHandleToIndex.Add(AbilitySpec.Handle, SpecIndex);
+	}
+}
+
+void UALSAbilitySystemComponent::RemoveFromAbilityInputIndex(const FGameplayAbilitySpec& AbilitySpec)
+{
+	for (const FGameplayTag& Tag : AbilitySpec.DynamicAbilityTags)
+	{
+		InputTagToSpecHandles.RemoveSingle(Tag, AbilitySpec.Handle);
+	}
+
+	SpecHandleToIndex.Remove(AbilitySpec.Handle);
+}
+
+void UALSAbilitySystemComponent::RebuildAbilityInputIndex()
+{
+	InputTagToSpecHandles.Reset();
+	SpecHandleToIndex.Reset();
+
+	for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+	{
+		AddToAbilityInputIndex(AbilitySpec);
+	}
+}
+
+FGameplayAbilitySpec* UALSAbilitySystemComponent::FindAbilitySpecFromHandleCached(FGameplayAbilitySpecHandle Handle)
+{
+	if (const int32* CachedIndex = SpecHandleToIndex.Find(Handle))
+	{
+		if (ActivatableAbilities.Items.IsValidIndex(*CachedIndex))
+		{
+			FGameplayAbilitySpec& AbilitySpec = ActivatableAbilities.Items[*CachedIndex];
+			if (AbilitySpec.Handle == Handle)
+			{
+				return &AbilitySpec;
+			}
+		}
+	}
+
+	// The array got reordered since the index was cached, look it up and remember the new index
+	FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(Handle);
+	if (AbilitySpec)
+	{
+		SpecHandleToIndex.Add(Handle, AbilitySpec - ActivatableAbilities.Items.GetData());
+	}
+	return AbilitySpec;
+}
+
 void UALSAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGamePaused)
 {
 	if (HasMatchingGameplayTag(TAG_Gameplay_AbilityInputBlocked))
@@ -213,14 +291,12 @@ void UALSAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGame
 	static TArray<FGameplayAbilitySpecHandle> AbilitiesToActivate;
 	AbilitiesToActivate.Reset();
 
-	//@TODO: See if we can use FScopedServerAbilityRPCBatcher ScopedRPCBatcher in some of these loops
-
 	//
 	// Process all abilities that activate when the input is held.
 	//
 	for (const FGameplayAbilitySpecHandle& SpecHandle : InputHeldSpecHandles)
 	{
-		if (const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(SpecHandle))
+		if (const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle))
 		{
 			if (AbilitySpec->Ability && !AbilitySpec->IsActive())
 			{
@@ -239,7 +315,7 @@ void UALSAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGame
 	//
 	for (const FGameplayAbilitySpecHandle& SpecHandle : InputPressedSpecHandles)
 	{
-		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(SpecHandle))
+		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle))
 		{
 			if (AbilitySpec->Ability)
 			{
@@ -270,6 +346,9 @@ void UALSAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGame
 	//
 	for (const FGameplayAbilitySpecHandle& AbilitySpecHandle : AbilitiesToActivate)
 	{
+		// Coalesces the activation, target data and end ability RPCs of this ability into one ServerAbilityRPCBatch.
+		// The engine batches per ability, each activated ability still sends its own batch.
+		FScopedServerAbilityRPCBatcher ScopedRPCBatcher(this, AbilitySpecHandle);
 		TryActivateAbility(AbilitySpecHandle);
 	}
 
@@ -278,7 +357,7 @@ void UALSAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGame
 	//
 	for (const FGameplayAbilitySpecHandle& SpecHandle : InputReleasedSpecHandles)
 	{
-		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandle(SpecHandle))
+		if (FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromHandleCached(SpecHandle))
 		{
 			if (AbilitySpec->Ability)
 			{
@@ -372,9 +451,29 @@ void UALSAbilitySystemComponent::GetAdditionalActivationTagRequirements(const FG
 	}
 }
 
+const FALSAbilityActivationRequirements& UALSAbilitySystemComponent::GetActivationRequirements(const UALSGameplayAbility& Ability) const
+{
+	if (const FALSAbilityActivationRequirements* CachedRequirements = ActivationRequirementsCache.Find(Ability.GetClass()))
+	{
+		return *CachedRequirements;
+	}
+
+	FALSAbilityActivationRequirements& Requirements = ActivationRequirementsCache.Add(Ability.GetClass());
+	Requirements.RequiredTags = Ability.ActivationRequiredTags;
+	Requirements.BlockedTags = Ability.ActivationBlockedTags;
+
+	// Expand our ability tags to add additional required/blocked tags
+	GetAdditionalActivationTagRequirements(Ability.AbilityTags, Requirements.RequiredTags, Requirements.BlockedTags);
+
+	return Requirements;
+}
+
 void UALSAbilitySystemComponent::SetTagRelationshipMapping(UALSAbilityTagRelationshipMapping* NewMapping)
 {
 	TagRelationshipMapping = NewMapping;
+
+	// Cached requirements contain the expansion of the previous mapping
+	ActivationRequirementsCache.Reset();
 }
 
 void UALSAbilitySystemComponent::ClientNotifyAbilityFailed_Implementation(const UGameplayAbility* Ability, const FGameplayTagContainer& FailureReason)
@@ -467,42 +566,115 @@ void UALSAbilitySystemComponent::CancelActivationGroupAbilities(EALSAbilityActiv
 	CancelAbilitiesByFunc(ShouldCancelFunc, bReplicateCancelAbility);
 }
 
+bool UALSAbilitySystemComponent::CacheDynamicTagGameplayEffect()
+{
+	if (!DynamicTagGameplayEffect)
+	{
+		DynamicTagGameplayEffect = UALSAssetManager::GetSubclass(UALSGameData::Get().DynamicTagGameplayEffect);
+		if (!DynamicTagGameplayEffect)
+		{
+			return false;
+		}
+
+		const UGameplayEffect* EffectCDO = DynamicTagGameplayEffect->GetDefaultObject<UGameplayEffect>();
+		bDynamicTagsAsLooseTags = (EffectCDO->DurationPolicy == EGameplayEffectDurationType::Infinite)
+			&& (EffectCDO->StackingType == EGameplayEffectStackingType::None)
+			&& (EffectCDO->Modifiers.Num() == 0)
+			&& (EffectCDO->Executions.Num() == 0)
+			&& (EffectCDO->GameplayCues.Num() == 0)
+			&& EffectCDO->InheritableOwnedTagsContainer.CombinedTags.IsEmpty()
+			&& EffectCDO->ApplicationTagRequirements.IsEmpty();
+
+		// Attribute captures are taken from the source when the spec is made, a template would freeze them
+		TArray<FGameplayEffectAttributeCaptureDefinition> CaptureDefinitions;
+		for (const FGameplayModifierInfo& Modifier : EffectCDO->Modifiers)
+		{
+			Modifier.ModifierMagnitude.GetAttributeCaptureDefinitions(CaptureDefinitions);
+		}
+		for (const FGameplayEffectExecutionDefinition& Execution : EffectCDO->Executions)
+		{
+			Execution.GetAttributeCaptureDefinitions(CaptureDefinitions);
+		}
+		bDynamicTagSpecReusable = (CaptureDefinitions.Num() == 0);
+
+		DynamicTagRemovalQuery.EffectDefinition = DynamicTagGameplayEffect;
+		DynamicTagRemovalQuery.CustomMatchDelegate.BindUObject(this, &ThisClass::MatchesDynamicTagEffect);
+	}
+
+	if (bDynamicTagSpecReusable && !DynamicTagSpecTemplate.IsValid())
+	{
+		DynamicTagSpecTemplate = MakeOutgoingSpec(DynamicTagGameplayEffect, 1.0f, MakeEffectContext());
+	}
+
+	return true;
+}
+
+bool UALSAbilitySystemComponent::MatchesDynamicTagEffect(const FActiveGameplayEffect& Effect) const
+{
+	return Effect.Spec.DynamicGrantedTags.HasTag(DynamicTagToRemove);
+}
+
 void UALSAbilitySystemComponent::AddDynamicTagGameplayEffect(const FGameplayTag& Tag)
 {
-	const TSubclassOf<UGameplayEffect> DynamicTagGE = UALSAssetManager::GetSubclass(UALSGameData::Get().DynamicTagGameplayEffect);
-	if (!DynamicTagGE)
+	if (!CacheDynamicTagGameplayEffect())
 	{
 		UE_LOG(LogALSAbilitySystem, Warning, TEXT("AddDynamicTagGameplayEffect: Unable to find DynamicTagGameplayEffect [%s]."), *UALSGameData::Get().DynamicTagGameplayEffect.GetAssetName());
 		return;
 	}
 
-	const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingSpec(DynamicTagGE, 1.0f, MakeEffectContext());
-	FGameplayEffectSpec* Spec = SpecHandle.Data.Get();
+	if (bDynamicTagsAsLooseTags && IsOwnerActorAuthoritative())
+	{
+		// The replicated container only feeds clients, the authority needs the tag in its own count map too
+		AddLooseGameplayTag(Tag);
+		AddReplicatedLooseGameplayTag(Tag);
+		++LooseDynamicTagGrantCounts.FindOrAdd(Tag);
+		return;
+	}
 
-	if (!Spec)
+	if (!DynamicTagSpecTemplate.IsValid())
 	{
-		UE_LOG(LogALSAbilitySystem, Warning, TEXT("AddDynamicTagGameplayEffect: Unable to make outgoing spec for [%s]."), *GetNameSafe(DynamicTagGE));
+		const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingSpec(DynamicTagGameplayEffect, 1.0f, MakeEffectContext());
+		if (FGameplayEffectSpec* Spec = SpecHandle.Data.Get())
+		{
+			Spec->DynamicGrantedTags.AddTag(Tag);
+			ApplyGameplayEffectSpecToSelf(*Spec);
+		}
 		return;
 	}
 
-	Spec->DynamicGrantedTags.AddTag(Tag);
+	// Every application gets its own context, only the spec setup is shared
+	FGameplayEffectSpec Spec(*DynamicTagSpecTemplate.Data.Get());
+	Spec.SetContext(MakeEffectContext());
+	Spec.DynamicGrantedTags.AddTag(Tag);
 
-	ApplyGameplayEffectSpecToSelf(*Spec);
+	ApplyGameplayEffectSpecToSelf(Spec);
 }
 
 void UALSAbilitySystemComponent::RemoveDynamicTagGameplayEffect(const FGameplayTag& Tag)
 {
-	const TSubclassOf<UGameplayEffect> DynamicTagGE = UALSAssetManager::GetSubclass(UALSGameData::Get().DynamicTagGameplayEffect);
-	if (!DynamicTagGE)
+	if (!CacheDynamicTagGameplayEffect())
 	{
 		UE_LOG(LogALSAbilitySystem, Warning, TEXT("RemoveDynamicTagGameplayEffect: Unable to find gameplay effect [%s]."), *UALSGameData::Get().DynamicTagGameplayEffect.GetAssetName());
 		return;
 	}
 
-	FGameplayEffectQuery Query = FGameplayEffectQuery::MakeQuery_MatchAnyOwningTags(FGameplayTagContainer(Tag));
-	Query.EffectDefinition = DynamicTagGE;
+	if (bDynamicTagsAsLooseTags && IsOwnerActorAuthoritative())
+	{
+		// Drops every grant of ours like the effect path does, other sources may hold the same loose tag
+		int32 GrantCount = 0;
+		if (LooseDynamicTagGrantCounts.RemoveAndCopyValue(Tag, GrantCount))
+		{
+			RemoveLooseGameplayTag(Tag, GrantCount);
+			for (int32 Index = 0; Index < GrantCount; ++Index)
+			{
+				RemoveReplicatedLooseGameplayTag(Tag);
+			}
+		}
+		return;
+	}
 
-	RemoveActiveEffects(Query);
+	TGuardValue<FGameplayTag> TagToRemoveGuard(DynamicTagToRemove, Tag);
+	RemoveActiveEffects(DynamicTagRemovalQuery);
 }
 
 void UALSAbilitySystemComponent::GetAbilityTargetData(const FGameplayAbilitySpecHandle AbilityHandle, FGameplayAbilityActivationInfo ActivationInfo, FGameplayAbilityTargetDataHandle& OutTargetDataHandle)
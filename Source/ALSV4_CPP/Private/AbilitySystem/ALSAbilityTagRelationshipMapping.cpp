@@ -2,22 +2,90 @@
 
 
 #include "AbilitySystem/ALSAbilityTagRelationshipMapping.h"
+#include "GameplayTagsManager.h"
+
+void UALSAbilityTagRelationshipMapping::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileRelationships();
+}
+
+#if WITH_EDITOR
+void UALSAbilityTagRelationshipMapping::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Recompiled on next use
+	bRelationshipsCompiled = false;
+}
+#endif
+
+void UALSAbilityTagRelationshipMapping::CompileRelationships() const
+{
+	CompiledRelationships.Reset();
+	CompiledCancelTagsByExactTag.Reset();
+
+	const UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+
+	for (const FALSAbilityTagRelationship& Tags : AbilityTagRelationships)
+	{
+		if (!Tags.AbilityTag.IsValid())
+		{
+			continue;
+		}
+
+		CompiledCancelTagsByExactTag.FindOrAdd(Tags.AbilityTag).AppendTags(Tags.AbilityTagsToCancel);
+
+		// An ability owning the relationship tag or any of its children matches the relationship (same as HasTag)
+		FGameplayTagContainer MatchingTags = TagsManager.RequestGameplayTagChildren(Tags.AbilityTag);
+		MatchingTags.AddTag(Tags.AbilityTag);
+
+		for (const FGameplayTag& MatchingTag : MatchingTags)
+		{
+			FALSCompiledAbilityTagRelationship& Compiled = CompiledRelationships.FindOrAdd(MatchingTag);
+			Compiled.AbilityTagsToBlock.AppendTags(Tags.AbilityTagsToBlock);
+			Compiled.AbilityTagsToCancel.AppendTags(Tags.AbilityTagsToCancel);
+			Compiled.ActivationRequiredTags.AppendTags(Tags.ActivationRequiredTags);
+			Compiled.ActivationBlockedTags.AppendTags(Tags.ActivationBlockedTags);
+		}
+	}
+
+	bRelationshipsCompiled = true;
+}
+
+const FALSCompiledAbilityTagRelationship* UALSAbilityTagRelationshipMapping::FindCompiledRelationship(const FGameplayTag& AbilityTag) const
+{
+	// Tags registered after compiling aren't in the table, their closest registered parent has the same relationships
+	for (FGameplayTag Tag = AbilityTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	{
+		if (const FALSCompiledAbilityTagRelationship* Compiled = CompiledRelationships.Find(Tag))
+		{
+			return Compiled;
+		}
+	}
+
+	return nullptr;
+}
 
 void UALSAbilityTagRelationshipMapping::GetAbilityTagsToBlockAndCancel(const FGameplayTagContainer& AbilityTags, FGameplayTagContainer* OutTagsToBlock, FGameplayTagContainer* OutTagsToCancel) const
 {
-	// Simple iteration for now
-	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
+	if (!bRelationshipsCompiled)
 	{
-		const FALSAbilityTagRelationship& Tags = AbilityTagRelationships[i];
-		if (AbilityTags.HasTag(Tags.AbilityTag))
+		CompileRelationships();
+	}
+
+	for (const FGameplayTag& AbilityTag : AbilityTags)
+	{
+		if (const FALSCompiledAbilityTagRelationship* Compiled = FindCompiledRelationship(AbilityTag))
 		{
 			if (OutTagsToBlock)
 			{
-				OutTagsToBlock->AppendTags(Tags.AbilityTagsToBlock);
+				OutTagsToBlock->AppendTags(Compiled->AbilityTagsToBlock);
 			}
 			if (OutTagsToCancel)
 			{
-				OutTagsToCancel->AppendTags(Tags.AbilityTagsToCancel);
+				OutTagsToCancel->AppendTags(Compiled->AbilityTagsToCancel);
 			}
 		}
 	}
@@ -25,19 +93,22 @@ void UALSAbilityTagRelationshipMapping::GetAbilityTagsToBlockAndCancel(const FGa
 
 void UALSAbilityTagRelationshipMapping::GetRequiredAndBlockedActivationTags(const FGameplayTagContainer& AbilityTags, FGameplayTagContainer* OutActivationRequired, FGameplayTagContainer* OutActivationBlocked) const
 {
-	// Simple iteration for now
-	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
+	if (!bRelationshipsCompiled)
+	{
+		CompileRelationships();
+	}
+
+	for (const FGameplayTag& AbilityTag : AbilityTags)
 	{
-		const FALSAbilityTagRelationship& Tags = AbilityTagRelationships[i];
-		if (AbilityTags.HasTag(Tags.AbilityTag))
+		if (const FALSCompiledAbilityTagRelationship* Compiled = FindCompiledRelationship(AbilityTag))
 		{
 			if (OutActivationRequired)
 			{
-				OutActivationRequired->AppendTags(Tags.ActivationRequiredTags);
+				OutActivationRequired->AppendTags(Compiled->ActivationRequiredTags);
 			}
 			if (OutActivationBlocked)
 			{
-				OutActivationBlocked->AppendTags(Tags.ActivationBlockedTags);
+				OutActivationBlocked->AppendTags(Compiled->ActivationBlockedTags);
 			}
 		}
 	}
@@ -45,16 +116,11 @@ void UALSAbilityTagRelationshipMapping::GetRequiredAndBlockedActivationTags(cons
 
 bool UALSAbilityTagRelationshipMapping::IsAbilityCancelledByTag(const FGameplayTagContainer& AbilityTags, const FGameplayTag& ActionTag) const
 {
-	// Simple iteration for now
-	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
+	if (!bRelationshipsCompiled)
 	{
-		const FALSAbilityTagRelationship& Tags = AbilityTagRelationships[i];
-
-		if (Tags.AbilityTag == ActionTag && Tags.AbilityTagsToCancel.HasAny(AbilityTags))
-		{
-			return true;
-		}
+		CompileRelationships();
 	}
 
-	return false;
-}
\ No newline at end of file
+	const FGameplayTagContainer* CancelTags = CompiledCancelTagsByExactTag.Find(ActionTag);
+	return CancelTags && CancelTags->HasAny(AbilityTags);
+}
@@ -2,6 +2,12 @@
 #include "Net/UnrealNetwork.h"
 #include "AbilitySystem/ALSAbilitySystemComponent.h"
 
+static TAutoConsoleVariable<int32> CVarGlobalOperationsPerFrame(
+	TEXT("ALS.GlobalAbilitySystem.OperationsPerFrame"),
+	16,
+	TEXT("Maximum number of ASCs a global ability/effect is applied to or removed from per frame."),
+	ECVF_Default);
+
 void FGlobalAppliedAbilityList::AddToASC(TSubclassOf<UGameplayAbility> Ability, UALSAbilitySystemComponent* ASC)
 {
 	if (FGameplayAbilitySpecHandle* SpecHandle = Handles.Find(ASC))
@@ -75,26 +81,262 @@ UALSGlobalAbilitySystem::UALSGlobalAbilitySystem()
 {
 }
 
+void UALSGlobalAbilitySystem::Deinitialize()
+{
+	PendingOperations.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UALSGlobalAbilitySystem::IsTickable() const
+{
+	return PendingOperations.Num() > 0;
+}
+
+TStatId UALSGlobalAbilitySystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UALSGlobalAbilitySystem, STATGROUP_Tickables);
+}
+
+void UALSGlobalAbilitySystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	int32 Budget = FMath::Max(1, CVarGlobalOperationsPerFrame.GetValueOnGameThread());
+	while (Budget > 0 && PendingOperations.Num() > 0)
+	{
+		FALSPendingGlobalOperation& Operation = PendingOperations[0];
+		ProcessOperation(Operation, Budget);
+
+		UClass* OperationClass = Operation.GetOperationClass();
+		const bool bRemoving = Operation.Type == EALSGlobalOperationType::Remove;
+		const int32 NumProcessed = Operation.NextTarget;
+		const int32 NumTotal = Operation.Targets.Num();
+
+		if (Operation.IsFinished())
+		{
+			PendingOperations.RemoveAt(0);
+		}
+
+		// Listeners are allowed to queue or cancel operations, don't touch Operation past this point
+		OnOperationProgress.Broadcast(OperationClass, bRemoving, NumProcessed, NumTotal);
+	}
+}
+
+void UALSGlobalAbilitySystem::ProcessOperation(FALSPendingGlobalOperation& Operation, int32& Budget)
+{
+	if (Operation.Type == EALSGlobalOperationType::Apply)
+	{
+		FGlobalAppliedAbilityList* AbilityEntry = Operation.Ability ? AppliedAbilities.Find(Operation.Ability) : nullptr;
+		FGlobalAppliedEffectList* EffectEntry = Operation.Effect ? AppliedEffects.Find(Operation.Effect) : nullptr;
+		if (!AbilityEntry && !EffectEntry)
+		{
+			Operation.NextTarget = Operation.Targets.Num();
+			return;
+		}
+
+		while (Budget > 0 && !Operation.IsFinished())
+		{
+			UALSAbilitySystemComponent* ASC = Operation.Targets[Operation.NextTarget++].Get();
+
+			// Skip ASCs which unregistered meanwhile, or got the ability/effect when they registered
+			if (ASC == nullptr || !RegisteredASCs.Contains(ASC))
+			{
+				continue;
+			}
+
+			if (AbilityEntry && !AbilityEntry->Handles.Contains(ASC))
+			{
+				AbilityEntry->AddToASC(Operation.Ability, ASC);
+				--Budget;
+			}
+			else if (EffectEntry && !EffectEntry->Handles.Contains(ASC))
+			{
+				EffectEntry->AddToASC(Operation.Effect, ASC);
+				--Budget;
+			}
+		}
+	}
+	else
+	{
+		while (Budget > 0 && !Operation.IsFinished())
+		{
+			const int32 Index = Operation.NextTarget++;
+			if (UALSAbilitySystemComponent* ASC = Operation.Targets[Index].Get())
+			{
+				if (Operation.Ability)
+				{
+					ASC->ClearAbility(Operation.AbilityHandles[Index]);
+				}
+				else
+				{
+					ASC->RemoveActiveGameplayEffect(Operation.EffectHandles[Index]);
+				}
+				--Budget;
+			}
+		}
+	}
+}
+
+int32 UALSGlobalAbilitySystem::FindPendingOperation(const UClass* AbilityOrEffectClass) const
+{
+	return PendingOperations.IndexOfByPredicate([AbilityOrEffectClass](const FALSPendingGlobalOperation& Operation)
+	{
+		return Operation.GetOperationClass() == AbilityOrEffectClass;
+	});
+}
+
+void UALSGlobalAbilitySystem::QueueRemoval(TSubclassOf<UGameplayAbility> Ability, FGlobalAppliedAbilityList& Entry)
+{
+	if (Entry.Handles.Num() == 0)
+	{
+		return;
+	}
+
+	FALSPendingGlobalOperation& Operation = PendingOperations.AddDefaulted_GetRef();
+	Operation.Type = EALSGlobalOperationType::Remove;
+	Operation.Ability = Ability;
+	Operation.Targets.Reserve(Entry.Handles.Num());
+	Operation.AbilityHandles.Reserve(Entry.Handles.Num());
+	for (const auto& KVP : Entry.Handles)
+	{
+		Operation.Targets.Add(KVP.Key);
+		Operation.AbilityHandles.Add(KVP.Value);
+	}
+	Entry.Handles.Empty();
+}
+
+void UALSGlobalAbilitySystem::QueueRemoval(TSubclassOf<UGameplayEffect> Effect, FGlobalAppliedEffectList& Entry)
+{
+	if (Entry.Handles.Num() == 0)
+	{
+		return;
+	}
+
+	FALSPendingGlobalOperation& Operation = PendingOperations.AddDefaulted_GetRef();
+	Operation.Type = EALSGlobalOperationType::Remove;
+	Operation.Effect = Effect;
+	Operation.Targets.Reserve(Entry.Handles.Num());
+	Operation.EffectHandles.Reserve(Entry.Handles.Num());
+	for (const auto& KVP : Entry.Handles)
+	{
+		Operation.Targets.Add(KVP.Key);
+		Operation.EffectHandles.Add(KVP.Value);
+	}
+	Entry.Handles.Empty();
+}
+
+void UALSGlobalAbilitySystem::RestoreRemainingHandles(const FALSPendingGlobalOperation& Operation)
+{
+	FGlobalAppliedAbilityList* AbilityEntry = Operation.Ability ? &AppliedAbilities.FindOrAdd(Operation.Ability) : nullptr;
+	FGlobalAppliedEffectList* EffectEntry = Operation.Effect ? &AppliedEffects.FindOrAdd(Operation.Effect) : nullptr;
+
+	for (int32 Index = Operation.NextTarget; Index < Operation.Targets.Num(); ++Index)
+	{
+		UALSAbilitySystemComponent* ASC = Operation.Targets[Index].Get();
+		if (ASC == nullptr)
+		{
+			continue;
+		}
+
+		const bool bRegistered = RegisteredASCs.Contains(ASC);
+		if (AbilityEntry)
+		{
+			if (bRegistered)
+			{
+				AbilityEntry->Handles.Add(ASC, Operation.AbilityHandles[Index]);
+			}
+			else
+			{
+				ASC->ClearAbility(Operation.AbilityHandles[Index]);
+			}
+		}
+		else if (EffectEntry)
+		{
+			if (bRegistered)
+			{
+				EffectEntry->Handles.Add(ASC, Operation.EffectHandles[Index]);
+			}
+			else
+			{
+				ASC->RemoveActiveGameplayEffect(Operation.EffectHandles[Index]);
+			}
+		}
+	}
+}
+
 void UALSGlobalAbilitySystem::ApplyAbilityToAll(TSubclassOf<UGameplayAbility> Ability)
 {
-	if ((Ability.Get() != nullptr) && (!AppliedAbilities.Contains(Ability)))
+	if (Ability.Get() == nullptr)
+	{
+		return;
+	}
+
+	const int32 PendingIndex = FindPendingOperation(Ability);
+	if (const FGlobalAppliedAbilityList* ExistingEntry = AppliedAbilities.Find(Ability))
+	{
+		// Applied to every ASC already or still being applied, otherwise a cancelled application left some ASCs without it
+		if (PendingIndex != INDEX_NONE || ExistingEntry->Handles.Num() >= RegisteredASCs.Num())
+		{
+			return;
+		}
+	}
+	else if (PendingIndex != INDEX_NONE)
 	{
-		FGlobalAppliedAbilityList& Entry = AppliedAbilities.Add(Ability);		
-		for (UALSAbilitySystemComponent* ASC : RegisteredASCs)
+		// A pending removal of the same ability is undone, ASCs it didn't reach yet keep their spec
+		RestoreRemainingHandles(PendingOperations[PendingIndex]);
+		PendingOperations.RemoveAt(PendingIndex);
+	}
+
+	const FGlobalAppliedAbilityList& Entry = AppliedAbilities.FindOrAdd(Ability);
+
+	FALSPendingGlobalOperation& Operation = PendingOperations.AddDefaulted_GetRef();
+	Operation.Type = EALSGlobalOperationType::Apply;
+	Operation.Ability = Ability;
+	Operation.Targets.Reserve(FMath::Max(0, RegisteredASCs.Num() - Entry.Handles.Num()));
+	for (UALSAbilitySystemComponent* ASC : RegisteredASCs)
+	{
+		if (!Entry.Handles.Contains(ASC))
 		{
-			Entry.AddToASC(Ability, ASC);
+			Operation.Targets.Add(ASC);
 		}
 	}
 }
 
 void UALSGlobalAbilitySystem::ApplyEffectToAll(TSubclassOf<UGameplayEffect> Effect)
 {
-	if ((Effect.Get() != nullptr) && (!AppliedEffects.Contains(Effect)))
+	if (Effect.Get() == nullptr)
 	{
-		FGlobalAppliedEffectList& Entry = AppliedEffects.Add(Effect);
-		for (UALSAbilitySystemComponent* ASC : RegisteredASCs)
+		return;
+	}
+
+	const int32 PendingIndex = FindPendingOperation(Effect);
+	if (const FGlobalAppliedEffectList* ExistingEntry = AppliedEffects.Find(Effect))
+	{
+		// Applied to every ASC already or still being applied, otherwise a cancelled application left some ASCs without it
+		if (PendingIndex != INDEX_NONE || ExistingEntry->Handles.Num() >= RegisteredASCs.Num())
+		{
+			return;
+		}
+	}
+	else if (PendingIndex != INDEX_NONE)
+	{
+		// A pending removal of the same effect is undone, ASCs it didn't reach yet keep the effect
+		RestoreRemainingHandles(PendingOperations[PendingIndex]);
+		PendingOperations.RemoveAt(PendingIndex);
+	}
+
+	const FGlobalAppliedEffectList& Entry = AppliedEffects.FindOrAdd(Effect);
+
+	FALSPendingGlobalOperation& Operation = PendingOperations.AddDefaulted_GetRef();
+	Operation.Type = EALSGlobalOperationType::Apply;
+	Operation.Effect = Effect;
+	Operation.Targets.Reserve(FMath::Max(0, RegisteredASCs.Num() - Entry.Handles.Num()));
+	for (UALSAbilitySystemComponent* ASC : RegisteredASCs)
+	{
+		if (!Entry.Handles.Contains(ASC))
 		{
-			Entry.AddToASC(Effect, ASC);
+			Operation.Targets.Add(ASC);
 		}
 	}
 }
@@ -103,8 +345,14 @@ void UALSGlobalAbilitySystem::RemoveAbilityFromAll(TSubclassOf<UGameplayAbility>
 {
 	if ((Ability.Get() != nullptr) && AppliedAbilities.Contains(Ability))
 	{
-		FGlobalAppliedAbilityList& Entry = AppliedAbilities[Ability];
-		Entry.RemoveFromAll();
+		// A pending application only has to be undone for the ASCs it already reached
+		const int32 PendingIndex = FindPendingOperation(Ability);
+		if (PendingIndex != INDEX_NONE)
+		{
+			PendingOperations.RemoveAt(PendingIndex);
+		}
+
+		QueueRemoval(Ability, AppliedAbilities[Ability]);
 		AppliedAbilities.Remove(Ability);
 	}
 }
@@ -113,12 +361,41 @@ void UALSGlobalAbilitySystem::RemoveEffectFromAll(TSubclassOf<UGameplayEffect> E
 {
 	if ((Effect.Get() != nullptr) && AppliedEffects.Contains(Effect))
 	{
-		FGlobalAppliedEffectList& Entry = AppliedEffects[Effect];
-		Entry.RemoveFromAll();
+		// A pending application only has to be undone for the ASCs it already reached
+		const int32 PendingIndex = FindPendingOperation(Effect);
+		if (PendingIndex != INDEX_NONE)
+		{
+			PendingOperations.RemoveAt(PendingIndex);
+		}
+
+		QueueRemoval(Effect, AppliedEffects[Effect]);
 		AppliedEffects.Remove(Effect);
 	}
 }
 
+bool UALSGlobalAbilitySystem::CancelPendingOperation(UClass* AbilityOrEffectClass)
+{
+	const int32 PendingIndex = FindPendingOperation(AbilityOrEffectClass);
+	if (PendingIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Handles a cancelled removal didn't get to are still applied, keep tracking them
+	if (PendingOperations[PendingIndex].Type == EALSGlobalOperationType::Remove)
+	{
+		RestoreRemainingHandles(PendingOperations[PendingIndex]);
+	}
+
+	PendingOperations.RemoveAt(PendingIndex);
+	return true;
+}
+
+bool UALSGlobalAbilitySystem::HasPendingOperation(UClass* AbilityOrEffectClass) const
+{
+	return FindPendingOperation(AbilityOrEffectClass) != INDEX_NONE;
+}
+
 void UALSGlobalAbilitySystem::RegisterASC(UALSAbilitySystemComponent* ASC)
 {
 	check(ASC);
@@ -132,7 +409,7 @@ void UALSGlobalAbilitySystem::RegisterASC(UALSAbilitySystemComponent* ASC)
 		Entry.Value.AddToASC(Entry.Key, ASC);
 	}
 
-	RegisteredASCs.AddUnique(ASC);
+	RegisteredASCs.Add(ASC);
 }
 
 void UALSGlobalAbilitySystem::UnregisterASC(UALSAbilitySystemComponent* ASC)
@@ -147,5 +424,6 @@ void UALSGlobalAbilitySystem::UnregisterASC(UALSAbilitySystemComponent* ASC)
 		Entry.Value.RemoveFromASC(ASC);
 	}
 
+	// Pending removals still reach the ASC through their weak pointers, pending applications skip it
 	RegisteredASCs.Remove(ASC);
 }
@@ -13,6 +13,7 @@
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemGlobals.h"
 #include "AbilitySystemLog.h"
+#include "AbilitySystemStats.h"
 #include "AbilitySystem/Abilities/ALSAbilitySimpleFailureMessage.h"
 #include "GameFramework/GameplayMessageSubsystem.h"
 #include "AbilitySystem/ALSAbilitySourceInterface.h"
@@ -21,6 +22,8 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ALSGameplayAbility)
 
+DECLARE_CYCLE_STAT(TEXT("ALS DoesAbilitySatisfyTagRequirements"), STAT_ALSAbilityTagRequirements, STATGROUP_AbilitySystem);
+
 #define ENSURE_ABILITY_IS_INSTANTIATED_OR_RETURN(FunctionName, ReturnValue)																				\
 {																																						\
 if (!ensure(IsInstantiated()))																														\
@@ -315,6 +318,7 @@ void UALSGameplayAbility::ApplyAbilityTagsToGameplayEffectSpec(FGameplayEffectSp
 bool UALSGameplayAbility::DoesAbilitySatisfyTagRequirements(const UAbilitySystemComponent& AbilitySystemComponent, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags, OUT FGameplayTagContainer* OptionalRelevantTags) const
 {
 	// Specialized version to handle death exclusion and AbilityTags expansion via ASC
+	SCOPE_CYCLE_COUNTER(STAT_ALSAbilityTagRequirements);
 
 	bool bBlocked = false;
 	bool bMissing = false;
@@ -329,31 +333,18 @@ bool UALSGameplayAbility::DoesAbilitySatisfyTagRequirements(const UAbilitySystem
 		bBlocked = true;
 	}
 
+	// Required/blocked tags are cached per ability class by the ASC, and checked against its tag count map directly
 	const UALSAbilitySystemComponent* ALSASC = Cast<UALSAbilitySystemComponent>(&AbilitySystemComponent);
-	static FGameplayTagContainer AllRequiredTags;
-	static FGameplayTagContainer AllBlockedTags;
-
-	AllRequiredTags = ActivationRequiredTags;
-	AllBlockedTags = ActivationBlockedTags;
-
-	// Expand our ability tags to add additional required/blocked tags
-	if (ALSASC)
-	{
-		ALSASC->GetAdditionalActivationTagRequirements(AbilityTags, AllRequiredTags, AllBlockedTags);
-	}
+	const FGameplayTagContainer& AllRequiredTags = ALSASC ? ALSASC->GetActivationRequirements(*this).RequiredTags : ActivationRequiredTags;
+	const FGameplayTagContainer& AllBlockedTags = ALSASC ? ALSASC->GetActivationRequirements(*this).BlockedTags : ActivationBlockedTags;
 
 	// Check to see the required/blocked tags for this ability
 	if (AllBlockedTags.Num() || AllRequiredTags.Num())
 	{
-		static FGameplayTagContainer AbilitySystemComponentTags;
-		
-		AbilitySystemComponentTags.Reset();
-		AbilitySystemComponent.GetOwnedGameplayTags(AbilitySystemComponentTags);
-
-		if (AbilitySystemComponentTags.HasAny(AllBlockedTags))
+		if (AbilitySystemComponent.HasAnyMatchingGameplayTags(AllBlockedTags))
 		{
 			const FALSGameplayTags& GameplayTags = FALSGameplayTags::Get();
-			if (OptionalRelevantTags && AbilitySystemComponentTags.HasTag(GameplayTags.Status_Death))
+			if (OptionalRelevantTags && AbilitySystemComponent.HasMatchingGameplayTag(GameplayTags.Status_Death))
 			{
 				// If player is dead and was rejected due to blocking tags, give that feedback
 				OptionalRelevantTags->AddTag(GameplayTags.Ability_ActivateFail_IsDead);
@@ -362,7 +353,7 @@ bool UALSGameplayAbility::DoesAbilitySatisfyTagRequirements(const UAbilitySystem
 			bBlocked = true;
 		}
 
-		if (!AbilitySystemComponentTags.HasAll(AllRequiredTags))
+		if (!AbilitySystemComponent.HasAllMatchingGameplayTags(AllRequiredTags))
 		{
 			bMissing = true;
 		}
@@ -3,6 +3,95 @@
 
 #include "Camera/ALSCameraComponent.h"
 
+#include "Camera/ALSCameraMode.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSCameraComponent)
+
 UALSCameraComponent::UALSCameraComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	CameraModeStack = nullptr;
+}
+
+void UALSCameraComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	if (!CameraModeStack)
+	{
+		CameraModeStack = NewObject<UALSCameraModeStack>(this);
+		check(CameraModeStack);
+	}
+}
+
+void UALSCameraComponent::GetCameraView(float DeltaTime, FMinimalViewInfo& DesiredView)
+{
+	check(CameraModeStack);
+
+	UpdateCameraModes();
+
+	// Without a camera mode, behave like a plain camera component
+	FALSCameraModeView CameraModeView;
+	if (!CameraModeStack->EvaluateStack(DeltaTime, CameraModeView))
+	{
+		Super::GetCameraView(DeltaTime, DesiredView);
+		return;
+	}
+
+	// Keep player controller in sync with the latest view.
+	if (APawn* TargetPawn = Cast<APawn>(GetTargetActor()))
+	{
+		if (APlayerController* PC = TargetPawn->GetController<APlayerController>())
+		{
+			PC->SetControlRotation(CameraModeView.ControlRotation);
+		}
+	}
+
+	// Keep camera component in sync with the latest view.
+	SetWorldLocationAndRotation(CameraModeView.Location, CameraModeView.Rotation);
+	FieldOfView = CameraModeView.FieldOfView;
+
+	// Fill in desired view.
+	DesiredView.Location = CameraModeView.Location;
+	DesiredView.Rotation = CameraModeView.Rotation;
+	DesiredView.FOV = CameraModeView.FieldOfView;
+	DesiredView.OrthoWidth = OrthoWidth;
+	DesiredView.OrthoNearClipPlane = OrthoNearClipPlane;
+	DesiredView.OrthoFarClipPlane = OrthoFarClipPlane;
+	DesiredView.AspectRatio = AspectRatio;
+	DesiredView.bConstrainAspectRatio = bConstrainAspectRatio;
+	DesiredView.bUseFieldOfViewForLOD = bUseFieldOfViewForLOD;
+	DesiredView.ProjectionMode = ProjectionMode;
+
+	// See if the CameraActor wants to override the PostProcess settings used.
+	DesiredView.PostProcessBlendWeight = PostProcessBlendWeight;
+	if (PostProcessBlendWeight > 0.0f)
+	{
+		DesiredView.PostProcessSettings = PostProcessSettings;
+	}
+}
+
+void UALSCameraComponent::UpdateCameraModes()
+{
+	check(CameraModeStack);
+
+	if (CameraModeStack->IsStackActivate())
+	{
+		if (DetermineCameraModeDelegate.IsBound())
+		{
+			// Pushing the mode already on top is a no-op, switching reuses the pooled instance of the mode
+			if (const TSubclassOf<UALSCameraMode> CameraMode = DetermineCameraModeDelegate.Execute())
+			{
+				CameraModeStack->PushCameraMode(CameraMode);
+			}
+		}
+	}
+}
+
+void UALSCameraComponent::GetBlendInfo(float& OutWeightOfTopLayer, TSubclassOf<UALSCameraMode>& OutTopModeClass) const
 {
+	check(CameraModeStack);
+	CameraModeStack->GetBlendInfo(OutWeightOfTopLayer, OutTopModeClass);
 }
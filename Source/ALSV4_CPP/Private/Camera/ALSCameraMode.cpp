@@ -2,3 +2,427 @@
 
 
 #include "Camera/ALSCameraMode.h"
+
+#include "Camera/ALSCameraComponent.h"
+#include "GameFramework/Pawn.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSCameraMode)
+
+namespace ALSCameraMode
+{
+	static constexpr float DefaultFOV = 80.0f;
+	static constexpr float DefaultPitchMin = -89.0f;
+	static constexpr float DefaultPitchMax = 89.0f;
+
+	// Distinct camera mode classes rarely go beyond this, neither the pool nor the stack should grow during play
+	static constexpr int32 ExpectedCameraModeCount = 4;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// FALSCameraModeView
+//////////////////////////////////////////////////////////////////////////
+FALSCameraModeView::FALSCameraModeView()
+	: Location(ForceInit)
+	, Rotation(ForceInit)
+	, ControlRotation(ForceInit)
+	, FieldOfView(ALSCameraMode::DefaultFOV)
+{
+}
+
+void FALSCameraModeView::Blend(const FALSCameraModeView& Other, float OtherWeight)
+{
+	if (OtherWeight <= 0.0f)
+	{
+		return;
+	}
+	else if (OtherWeight >= 1.0f)
+	{
+		*this = Other;
+		return;
+	}
+
+	Location = FMath::Lerp(Location, Other.Location, OtherWeight);
+
+	const FRotator DeltaRotation = (Other.Rotation - Rotation).GetNormalized();
+	Rotation = Rotation + (OtherWeight * DeltaRotation);
+
+	const FRotator DeltaControlRotation = (Other.ControlRotation - ControlRotation).GetNormalized();
+	ControlRotation = ControlRotation + (OtherWeight * DeltaControlRotation);
+
+	FieldOfView = FMath::Lerp(FieldOfView, Other.FieldOfView, OtherWeight);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// UALSCameraMode
+//////////////////////////////////////////////////////////////////////////
+UALSCameraMode::UALSCameraMode()
+{
+	FieldOfView = ALSCameraMode::DefaultFOV;
+	ViewPitchMin = ALSCameraMode::DefaultPitchMin;
+	ViewPitchMax = ALSCameraMode::DefaultPitchMax;
+	ViewOffset = FVector::ZeroVector;
+
+	BlendTime = 0.5f;
+	BlendFunction = EALSCameraModeBlendFunction::EaseOut;
+	BlendExponent = 4.0f;
+	BlendAlpha = 1.0f;
+	BlendWeight = 1.0f;
+}
+
+UALSCameraComponent* UALSCameraMode::GetALSCameraComponent() const
+{
+	return CastChecked<UALSCameraComponent>(GetOuter());
+}
+
+UWorld* UALSCameraMode::GetWorld() const
+{
+	return HasAnyFlags(RF_ClassDefaultObject) ? nullptr : GetOuter()->GetWorld();
+}
+
+AActor* UALSCameraMode::GetTargetActor() const
+{
+	const UALSCameraComponent* ALSCameraComponent = GetALSCameraComponent();
+
+	return ALSCameraComponent->GetTargetActor();
+}
+
+FVector UALSCameraMode::GetPivotLocation() const
+{
+	const AActor* TargetActor = GetTargetActor();
+	check(TargetActor);
+
+	if (const APawn* TargetPawn = Cast<APawn>(TargetActor))
+	{
+		return TargetPawn->GetPawnViewLocation();
+	}
+
+	return TargetActor->GetActorLocation();
+}
+
+FRotator UALSCameraMode::GetPivotRotation() const
+{
+	const AActor* TargetActor = GetTargetActor();
+	check(TargetActor);
+
+	if (const APawn* TargetPawn = Cast<APawn>(TargetActor))
+	{
+		return TargetPawn->GetViewRotation();
+	}
+
+	return TargetActor->GetActorRotation();
+}
+
+void UALSCameraMode::UpdateCameraMode(float DeltaTime)
+{
+	UpdateView(DeltaTime);
+	UpdateBlending(DeltaTime);
+}
+
+void UALSCameraMode::UpdateView(float DeltaTime)
+{
+	FVector PivotLocation = GetPivotLocation();
+	FRotator PivotRotation = GetPivotRotation();
+
+	PivotRotation.Pitch = FMath::ClampAngle(PivotRotation.Pitch, ViewPitchMin, ViewPitchMax);
+
+	View.Location = PivotLocation + PivotRotation.RotateVector(ViewOffset);
+	View.Rotation = PivotRotation;
+	View.ControlRotation = View.Rotation;
+	View.FieldOfView = FieldOfView;
+}
+
+void UALSCameraMode::SetBlendWeight(float Weight)
+{
+	BlendWeight = FMath::Clamp(Weight, 0.0f, 1.0f);
+
+	// Since we're setting the blend weight directly, we need to calculate the blend alpha to account for the blend function.
+	const float InvExponent = (BlendExponent > 0.0f) ? (1.0f / BlendExponent) : 1.0f;
+
+	switch (BlendFunction)
+	{
+	case EALSCameraModeBlendFunction::Linear:
+		BlendAlpha = BlendWeight;
+		break;
+
+	case EALSCameraModeBlendFunction::EaseIn:
+		BlendAlpha = FMath::InterpEaseIn(0.0f, 1.0f, BlendWeight, InvExponent);
+		break;
+
+	case EALSCameraModeBlendFunction::EaseOut:
+		BlendAlpha = FMath::InterpEaseOut(0.0f, 1.0f, BlendWeight, InvExponent);
+		break;
+
+	case EALSCameraModeBlendFunction::EaseInOut:
+		BlendAlpha = FMath::InterpEaseInOut(0.0f, 1.0f, BlendWeight, InvExponent);
+		break;
+
+	default:
+		checkf(false, TEXT("SetBlendWeight: Invalid BlendFunction [%d]\n"), (uint8)BlendFunction);
+		break;
+	}
+}
+
+void UALSCameraMode::UpdateBlending(float DeltaTime)
+{
+	if (BlendTime > 0.0f)
+	{
+		BlendAlpha += (DeltaTime / BlendTime);
+		BlendAlpha = FMath::Min(BlendAlpha, 1.0f);
+	}
+	else
+	{
+		BlendAlpha = 1.0f;
+	}
+
+	const float Exponent = (BlendExponent > 0.0f) ? BlendExponent : 1.0f;
+
+	switch (BlendFunction)
+	{
+	case EALSCameraModeBlendFunction::Linear:
+		BlendWeight = BlendAlpha;
+		break;
+
+	case EALSCameraModeBlendFunction::EaseIn:
+		BlendWeight = FMath::InterpEaseIn(0.0f, 1.0f, BlendAlpha, Exponent);
+		break;
+
+	case EALSCameraModeBlendFunction::EaseOut:
+		BlendWeight = FMath::InterpEaseOut(0.0f, 1.0f, BlendAlpha, Exponent);
+		break;
+
+	case EALSCameraModeBlendFunction::EaseInOut:
+		BlendWeight = FMath::InterpEaseInOut(0.0f, 1.0f, BlendAlpha, Exponent);
+		break;
+
+	default:
+		checkf(false, TEXT("UpdateBlending: Invalid BlendFunction [%d]\n"), (uint8)BlendFunction);
+		break;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// UALSCameraModeStack
+//////////////////////////////////////////////////////////////////////////
+UALSCameraModeStack::UALSCameraModeStack()
+{
+	bIsActive = true;
+
+	CameraModeInstances.Reserve(ALSCameraMode::ExpectedCameraModeCount);
+	CameraModeStack.Reserve(ALSCameraMode::ExpectedCameraModeCount);
+}
+
+void UALSCameraModeStack::ActivateStack()
+{
+	if (!bIsActive)
+	{
+		bIsActive = true;
+
+		// Notify camera modes that they are being activated.
+		for (UALSCameraMode* CameraMode : CameraModeStack)
+		{
+			check(CameraMode);
+			CameraMode->OnActivation();
+		}
+	}
+}
+
+void UALSCameraModeStack::DeactivateStack()
+{
+	if (bIsActive)
+	{
+		bIsActive = false;
+
+		// Notify camera modes that they are being deactivated.
+		for (UALSCameraMode* CameraMode : CameraModeStack)
+		{
+			check(CameraMode);
+			CameraMode->OnDeactivation();
+		}
+	}
+}
+
+void UALSCameraModeStack::PushCameraMode(TSubclassOf<UALSCameraMode> CameraModeClass)
+{
+	if (!CameraModeClass)
+	{
+		return;
+	}
+
+	UALSCameraMode* CameraMode = GetCameraModeInstance(CameraModeClass);
+	check(CameraMode);
+
+	int32 StackSize = CameraModeStack.Num();
+
+	if ((StackSize > 0) && (CameraModeStack[0] == CameraMode))
+	{
+		// Already top of stack.
+		return;
+	}
+
+	// See if it's already in the stack and remove it.
+	// Figure out how much it was contributing to the stack.
+	int32 ExistingStackIndex = INDEX_NONE;
+	float ExistingStackContribution = 1.0f;
+
+	for (int32 StackIndex = 0; StackIndex < StackSize; ++StackIndex)
+	{
+		if (CameraModeStack[StackIndex] == CameraMode)
+		{
+			ExistingStackIndex = StackIndex;
+			ExistingStackContribution *= CameraMode->GetBlendWeight();
+			break;
+		}
+		else
+		{
+			ExistingStackContribution *= (1.0f - CameraModeStack[StackIndex]->GetBlendWeight());
+		}
+	}
+
+	if (ExistingStackIndex != INDEX_NONE)
+	{
+		CameraModeStack.RemoveAt(ExistingStackIndex, 1, false);
+		StackSize--;
+	}
+	else
+	{
+		ExistingStackContribution = 0.0f;
+	}
+
+	// Decide what initial weight to start with.
+	const bool bShouldBlend = ((CameraMode->GetBlendTime() > 0.0f) && (StackSize > 0));
+	const float BlendWeight = (bShouldBlend ? ExistingStackContribution : 1.0f);
+
+	CameraMode->SetBlendWeight(BlendWeight);
+
+	// Add new entry to top of stack.
+	CameraModeStack.Insert(CameraMode, 0);
+
+	// Make sure stack bottom is always weighted 100%.
+	CameraModeStack.Last()->SetBlendWeight(1.0f);
+
+	// Let the camera mode know if it's being added to the stack.
+	if (ExistingStackIndex == INDEX_NONE)
+	{
+		CameraMode->OnActivation();
+	}
+}
+
+bool UALSCameraModeStack::EvaluateStack(float DeltaTime, FALSCameraModeView& OutCameraModeView)
+{
+	if (!bIsActive || (CameraModeStack.Num() == 0))
+	{
+		return false;
+	}
+
+	UpdateStack(DeltaTime);
+	BlendStack(OutCameraModeView);
+
+	return true;
+}
+
+UALSCameraMode* UALSCameraModeStack::GetCameraModeInstance(TSubclassOf<UALSCameraMode> CameraModeClass)
+{
+	check(CameraModeClass);
+
+	// First see if we already created one.
+	for (UALSCameraMode* CameraMode : CameraModeInstances)
+	{
+		if ((CameraMode != nullptr) && (CameraMode->GetClass() == CameraModeClass))
+		{
+			return CameraMode;
+		}
+	}
+
+	// Not found, so we need to create it.
+	UALSCameraMode* NewCameraMode = NewObject<UALSCameraMode>(GetOuter(), CameraModeClass, NAME_None, RF_NoFlags);
+	check(NewCameraMode);
+
+	CameraModeInstances.Add(NewCameraMode);
+
+	return NewCameraMode;
+}
+
+void UALSCameraModeStack::UpdateStack(float DeltaTime)
+{
+	const int32 StackSize = CameraModeStack.Num();
+	if (StackSize <= 0)
+	{
+		return;
+	}
+
+	int32 RemoveCount = 0;
+	int32 RemoveIndex = INDEX_NONE;
+
+	for (int32 StackIndex = 0; StackIndex < StackSize; ++StackIndex)
+	{
+		UALSCameraMode* CameraMode = CameraModeStack[StackIndex];
+		check(CameraMode);
+
+		CameraMode->UpdateCameraMode(DeltaTime);
+
+		if (CameraMode->GetBlendWeight() >= 1.0f)
+		{
+			// Everything below this mode is now irrelevant and can be removed.
+			RemoveIndex = (StackIndex + 1);
+			RemoveCount = (StackSize - RemoveIndex);
+			break;
+		}
+	}
+
+	if (RemoveCount > 0)
+	{
+		// Let the camera modes know they being removed from the stack, they stay in the pool for the next push.
+		for (int32 StackIndex = RemoveIndex; StackIndex < StackSize; ++StackIndex)
+		{
+			UALSCameraMode* CameraMode = CameraModeStack[StackIndex];
+			check(CameraMode);
+
+			CameraMode->OnDeactivation();
+		}
+
+		CameraModeStack.RemoveAt(RemoveIndex, RemoveCount, false);
+	}
+}
+
+void UALSCameraModeStack::BlendStack(FALSCameraModeView& OutCameraModeView) const
+{
+	const int32 StackSize = CameraModeStack.Num();
+	if (StackSize <= 0)
+	{
+		return;
+	}
+
+	// Start at the bottom and blend up the stack
+	const UALSCameraMode* CameraMode = CameraModeStack[StackSize - 1];
+	check(CameraMode);
+
+	OutCameraModeView = CameraMode->GetCameraModeView();
+
+	for (int32 StackIndex = (StackSize - 2); StackIndex >= 0; --StackIndex)
+	{
+		CameraMode = CameraModeStack[StackIndex];
+		check(CameraMode);
+
+		OutCameraModeView.Blend(CameraMode->GetCameraModeView(), CameraMode->GetBlendWeight());
+	}
+}
+
+void UALSCameraModeStack::GetBlendInfo(float& OutWeightOfTopLayer, TSubclassOf<UALSCameraMode>& OutTopModeClass) const
+{
+	if (CameraModeStack.Num() == 0)
+	{
+		OutWeightOfTopLayer = 1.0f;
+		OutTopModeClass = nullptr;
+		return;
+	}
+	else
+	{
+		UALSCameraMode* TopEntry = CameraModeStack[0];
+		check(TopEntry);
+		OutWeightOfTopLayer = TopEntry->GetBlendWeight();
+		OutTopModeClass = TopEntry->GetClass();
+	}
+}
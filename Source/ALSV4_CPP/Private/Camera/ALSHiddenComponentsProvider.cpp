@@ -0,0 +1,54 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#include "Camera/ALSHiddenComponentsProvider.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSHiddenComponentsProvider)
+
+void IALSHiddenComponentsProvider::GatherAttachedPrimitives(const AActor& Actor, TSet<FPrimitiveComponentId>& OutHiddenComponents)
+{
+	static const FName NAME_NoParentAutoHide(TEXT("NoParentAutoHide"));
+
+	// add every component and all attached children
+	for (const UActorComponent* Component : Actor.GetComponents())
+	{
+		const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component);
+		if (Primitive && Primitive->IsRegistered())
+		{
+			OutHiddenComponents.Add(Primitive->ComponentId);
+
+			for (const USceneComponent* AttachedChild : Primitive->GetAttachChildren())
+			{
+				const UPrimitiveComponent* AttachChildPC = Cast<UPrimitiveComponent>(AttachedChild);
+				if (AttachChildPC && AttachChildPC->IsRegistered() && !AttachChildPC->ComponentTags.Contains(NAME_NoParentAutoHide))
+				{
+					OutHiddenComponents.Add(AttachChildPC->ComponentId);
+				}
+			}
+		}
+	}
+}
+
+uint32 IALSHiddenComponentsProvider::ComputeAttachmentRevision(const AActor& Actor)
+{
+	// Only hashes pointers and flags, much cheaper than gathering the set itself
+	uint32 Revision = 0;
+	for (const UActorComponent* Component : Actor.GetComponents())
+	{
+		const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component);
+		if (Primitive && Primitive->IsRegistered())
+		{
+			Revision = HashCombine(Revision, GetTypeHash(Primitive));
+
+			for (const USceneComponent* AttachedChild : Primitive->GetAttachChildren())
+			{
+				Revision = HashCombine(Revision, GetTypeHash(AttachedChild));
+				Revision = HashCombine(Revision, AttachedChild && AttachedChild->IsRegistered() ? 1u : 0u);
+			}
+		}
+	}
+	return Revision;
+}
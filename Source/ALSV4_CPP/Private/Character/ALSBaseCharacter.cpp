@@ -13,6 +13,7 @@
 #include "Components/CapsuleComponent.h"
 #include "Curves/CurveFloat.h"
 #include "Character/ALSCharacterMovementComponent.h"
+#include "Character/ALSCharacterRegistry.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/GameplayStatics.h"
@@ -45,6 +46,18 @@ void AALSBaseCharacter::PostInitializeComponents()
 	MyCharacterMovementComponent = Cast<UALSCharacterMovementComponent>(Super::GetMovementComponent());
 }
 
+void AALSBaseCharacter::PostRegisterAllComponents()
+{
+	Super::PostRegisterAllComponents();
+	MarkHiddenComponentsDirty();
+}
+
+void AALSBaseCharacter::PostUnregisterAllComponents()
+{
+	Super::PostUnregisterAllComponents();
+	MarkHiddenComponentsDirty();
+}
+
 void AALSBaseCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -117,6 +130,22 @@ void AALSBaseCharacter::BeginPlay()
 	MyCharacterMovementComponent->SetMovementSettings(GetTargetMovementSettings());
 
 	ALSDebugComponent = FindComponentByClass<UALSDebugComponent>();
+
+	if (UALSCharacterRegistry* Registry = UALSCharacterRegistry::Get(this))
+	{
+		CharacterRegistryIndex = Registry->RegisterCharacter(this);
+	}
+}
+
+void AALSBaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UALSCharacterRegistry* Registry = UALSCharacterRegistry::Get(this))
+	{
+		Registry->UnregisterCharacter(this, CharacterRegistryIndex);
+	}
+	CharacterRegistryIndex = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AALSBaseCharacter::Tick(float DeltaTime)
@@ -129,17 +158,18 @@ void AALSBaseCharacter::Tick(float DeltaTime)
 	if (MovementState == EALSMovementState::Grounded)
 	{
 		UpdateCharacterMovement();
-		UpdateGroundedRotation(DeltaTime);
-	}
-	else if (MovementState == EALSMovementState::InAir)
-	{
-		UpdateInAirRotation(DeltaTime);
 	}
 	else if (MovementState == EALSMovementState::Ragdoll)
 	{
 		RagdollUpdate(DeltaTime);
 	}
 
+	// Everyone else rotates in the movement component's PhysicsRotation, which simulated proxies don't run
+	if (GetLocalRole() == ROLE_SimulatedProxy)
+	{
+		UpdateCharacterRotation(DeltaTime);
+	}
+
 	// Cache values
 	PreviousVelocity = GetVelocity();
 	PreviousAimYaw = AimingRotation.Yaw;
@@ -246,6 +276,109 @@ void AALSBaseCharacter::Server_SetMeshLocationDuringRagdoll_Implementation(FVect
 	TargetRagdollLocation = MeshLocation;
 }
 
+void AALSBaseCharacter::ResetCharacterState()
+{
+	if (MovementState == EALSMovementState::Ragdoll)
+	{
+		// Same as RagdollEnd, minus the pose snapshot, get up montage and velocity carry over
+		if (UKismetSystemLibrary::IsDedicatedServer(GetWorld()))
+		{
+			GetMesh()->VisibilityBasedAnimTickOption = DefVisBasedTickOp;
+		}
+
+		GetMesh()->bEnableUpdateRateOptimizations = bPreRagdollURO;
+		MyCharacterMovementComponent->bIgnoreClientMovementErrorChecksAndCorrection = 0;
+		GetMesh()->bOnlyAllowAutonomousTickPose = false;
+		SetReplicateMovement(true);
+
+		GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		GetMesh()->SetCollisionObjectType(ECC_Pawn);
+		GetMesh()->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		GetMesh()->SetAllBodiesSimulatePhysics(false);
+
+		if (RagdollStateChangedDelegate.IsBound())
+		{
+			RagdollStateChangedDelegate.Broadcast(false);
+		}
+	}
+
+	GetMesh()->SetRelativeLocationAndRotation(GetBaseTranslationOffset(), GetBaseRotationOffset());
+
+	if (GetMesh()->GetAnimInstance())
+	{
+		GetMesh()->GetAnimInstance()->StopAllMontages(0.0f);
+	}
+
+	const AALSBaseCharacter* Defaults = GetClass()->GetDefaultObject<AALSBaseCharacter>();
+	DesiredGait = Defaults->DesiredGait;
+	DesiredStance = Defaults->DesiredStance;
+	DesiredRotationMode = Defaults->DesiredRotationMode;
+	ViewMode = Defaults->ViewMode;
+	OverlayState = Defaults->OverlayState;
+	MovementState = EALSMovementState::None;
+	MovementAction = EALSMovementAction::None;
+	bBreakFall = false;
+	bSprintHeld = false;
+
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->SetDefaultMovementMode();
+
+	// The movement mode is usually unchanged, so OnMovementModeChanged won't derive the movement state for us
+	SetMovementState(GetCharacterMovement()->IsMovingOnGround() ? EALSMovementState::Grounded : EALSMovementState::InAir, true);
+
+	ForceUpdateCharacterState();
+
+	if (Stance == EALSStance::Standing)
+	{
+		UnCrouch();
+	}
+	else if (Stance == EALSStance::Crouching)
+	{
+		Crouch();
+	}
+
+	TargetRotation = GetActorRotation();
+	LastVelocityRotation = TargetRotation;
+	LastMovementInputRotation = TargetRotation;
+}
+
+void AALSBaseCharacter::SetCharacterPooled(bool bPooled)
+{
+	if (bCharacterPooled == bPooled)
+	{
+		return;
+	}
+
+	bCharacterPooled = bPooled;
+
+	SetActorHiddenInGame(bPooled);
+	SetActorEnableCollision(!bPooled);
+	SetActorTickEnabled(!bPooled);
+	GetMesh()->SetComponentTickEnabled(!bPooled);
+	GetCharacterMovement()->SetComponentTickEnabled(!bPooled);
+
+	if (UALSCharacterRegistry* Registry = UALSCharacterRegistry::Get(this))
+	{
+		if (bPooled)
+		{
+			Registry->UnregisterCharacter(this, CharacterRegistryIndex);
+			CharacterRegistryIndex = INDEX_NONE;
+		}
+		else
+		{
+			CharacterRegistryIndex = Registry->RegisterCharacter(this);
+		}
+	}
+
+	if (!bPooled)
+	{
+		// The character was moved while parked
+		TargetRotation = GetActorRotation();
+		LastVelocityRotation = TargetRotation;
+		LastMovementInputRotation = TargetRotation;
+	}
+}
+
 void AALSBaseCharacter::SetMovementState(const EALSMovementState NewState, bool bForce)
 {
 	if (bForce || MovementState != NewState)
@@ -703,6 +836,50 @@ bool AALSBaseCharacter::CanPlayCameraShake() const
 	return ViewMode != EALSViewMode::TopDown;
 }
 
+void AALSBaseCharacter::GatherHiddenComponents(TSet<FPrimitiveComponentId>& OutHiddenComponents) const
+{
+	GatherAttachedPrimitives(*this, OutHiddenComponents);
+}
+
+uint32 AALSBaseCharacter::GetHiddenComponentsRevision() const
+{
+	// The primitives are only looked up again when components were added or removed, per frame only
+	// their attach children are hashed, which catches swaps (e.g. weapon A to weapon B) on any of them
+	const int32 NumComponents = GetComponents().Num();
+	if (NumComponents != HiddenComponentsSourceCount || HiddenComponentsRevision != HiddenComponentsSourceRevision)
+	{
+		HiddenComponentsPrimitives.Reset();
+		for (const UActorComponent* Component : GetComponents())
+		{
+			if (const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
+			{
+				HiddenComponentsPrimitives.Add(Primitive);
+			}
+		}
+
+		HiddenComponentsSourceCount = NumComponents;
+		HiddenComponentsSourceRevision = HiddenComponentsRevision;
+	}
+
+	uint32 Revision = HashCombine(HiddenComponentsRevision, GetTypeHash(NumComponents));
+	for (const TWeakObjectPtr<const UPrimitiveComponent>& PrimitivePtr : HiddenComponentsPrimitives)
+	{
+		const UPrimitiveComponent* Primitive = PrimitivePtr.Get();
+		if (!Primitive)
+		{
+			continue;
+		}
+
+		Revision = HashCombine(Revision, Primitive->IsRegistered() ? 1u : 0u);
+		for (const USceneComponent* AttachedChild : Primitive->GetAttachChildren())
+		{
+			Revision = HashCombine(Revision, GetTypeHash(AttachedChild));
+			Revision = HashCombine(Revision, AttachedChild && AttachedChild->IsRegistered() ? 1u : 0u);
+		}
+	}
+	return Revision;
+}
+
 void AALSBaseCharacter::RagdollUpdate(float DeltaTime)
 {
 	GetMesh()->bOnlyAllowAutonomousTickPose = false;
@@ -767,6 +944,7 @@ void AALSBaseCharacter::SetActorLocationDuringRagdoll(float DeltaTime)
 	const bool bHit = World->LineTraceSingleByChannel(HitResult, TargetRagdollLocation, TraceVect,
 	                                                  ECC_Visibility, Params);
 
+#if ENABLE_DRAW_DEBUG
 	if (ALSDebugComponent && ALSDebugComponent->GetShowTraces())
 	{
 		UALSDebugComponent::DrawDebugLineTraceSingle(World,
@@ -779,6 +957,7 @@ void AALSBaseCharacter::SetActorLocationDuringRagdoll(float DeltaTime)
 		                                             FLinearColor::Green,
 		                                             1.0f);
 	}
+#endif
 
 	bRagdollOnGround = HitResult.IsValidBlockingHit();
 	FVector NewRagdollLoc = TargetRagdollLocation;
@@ -1070,6 +1249,18 @@ void AALSBaseCharacter::UpdateCharacterMovement()
 	MyCharacterMovementComponent->SetAllowedGait(AllowedGait);
 }
 
+void AALSBaseCharacter::UpdateCharacterRotation(float DeltaTime)
+{
+	if (MovementState == EALSMovementState::Grounded)
+	{
+		UpdateGroundedRotation(DeltaTime);
+	}
+	else if (MovementState == EALSMovementState::InAir)
+	{
+		UpdateInAirRotation(DeltaTime);
+	}
+}
+
 void AALSBaseCharacter::UpdateGroundedRotation(float DeltaTime)
 {
 	if (MovementAction == EALSMovementAction::None)
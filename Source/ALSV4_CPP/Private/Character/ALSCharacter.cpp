@@ -92,6 +92,17 @@ void AALSCharacter::RagdollEnd()
 	UpdateHeldObject();
 }
 
+void AALSCharacter::ResetCharacterState()
+{
+	// Cleared first, resetting the overlay state attaches the default held object again
+	ClearHeldObject();
+
+	Super::ResetCharacterState();
+
+	PlayerController = nullptr;
+	PawnExtComponent->ResetPawnData();
+}
+
 ECollisionChannel AALSCharacter::GetThirdPersonTraceParams(FVector& TraceOrigin, float& TraceRadius)
 {
 	const FName CameraSocketName = bRightShoulder ? TEXT("TP_CameraTrace_R") : TEXT("TP_CameraTrace_L");
@@ -134,6 +145,9 @@ void AALSCharacter::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 
+	// Pooled characters begin play before they are possessed
+	PlayerController = Cast<APlayerController>(NewController);
+
 	PawnExtComponent->HandleControllerChanged();
 }
 
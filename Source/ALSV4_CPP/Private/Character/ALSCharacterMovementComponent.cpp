@@ -10,6 +10,8 @@
 UALSCharacterMovementComponent::UALSCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
+	// Rolling rotates the character while its root motion montage plays
+	bAllowPhysicsRotationDuringAnimRootMotion = true;
 }
 
 void UALSCharacterMovementComponent::OnMovementUpdated(float DeltaTime, const FVector& OldLocation,
@@ -33,6 +35,21 @@ void UALSCharacterMovementComponent::OnMovementUpdated(float DeltaTime, const FV
 	}
 }
 
+void UALSCharacterMovementComponent::PhysicsRotation(float DeltaTime)
+{
+	AALSBaseCharacter* ALSCharacter = Cast<AALSBaseCharacter>(CharacterOwner);
+	if (!ALSCharacter)
+	{
+		Super::PhysicsRotation(DeltaTime);
+		return;
+	}
+
+	// Rotating here instead of in the character's tick keeps the rotation inside PerformMovement's scoped update,
+	// so the capsule moves and rotates with a single transform propagation and overlap update, and the rotation
+	// is replayed with the saved move on corrections.
+	ALSCharacter->UpdateCharacterRotation(DeltaTime);
+}
+
 void UALSCharacterMovementComponent::PhysWalking(float deltaTime, int32 Iterations)
 {
 	if (CurrentMovementSettings.MovementCurve)
@@ -95,6 +112,7 @@ void UALSCharacterMovementComponent::FSavedMove_My::Clear()
 
 	bSavedRequestMovementSettingsChange = false;
 	SavedAllowedGait = EALSGait::Walking;
+	SavedTargetRotation = FRotator::ZeroRotator;
 }
 
 uint8 UALSCharacterMovementComponent::FSavedMove_My::GetCompressedFlags() const
@@ -122,6 +140,11 @@ void UALSCharacterMovementComponent::FSavedMove_My::SetMoveFor(ACharacter* Chara
 		bSavedRequestMovementSettingsChange = CharacterMovement->bRequestMovementSettingsChange;
 		SavedAllowedGait = CharacterMovement->AllowedGait;
 	}
+
+	if (const AALSBaseCharacter* ALSCharacter = Cast<AALSBaseCharacter>(Character))
+	{
+		SavedTargetRotation = ALSCharacter->GetTargetRotation();
+	}
 }
 
 void UALSCharacterMovementComponent::FSavedMove_My::PrepMoveFor(ACharacter* Character)
@@ -133,6 +156,25 @@ void UALSCharacterMovementComponent::FSavedMove_My::PrepMoveFor(ACharacter* Char
 	{
 		CharacterMovement->AllowedGait = SavedAllowedGait;
 	}
+
+	if (AALSBaseCharacter* ALSCharacter = Cast<AALSBaseCharacter>(Character))
+	{
+		ALSCharacter->SetTargetRotation(SavedTargetRotation);
+	}
+}
+
+void UALSCharacterMovementComponent::FSavedMove_My::CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter,
+                                                                APlayerController* PC, const FVector& OldStartLocation)
+{
+	Super::CombineWith(OldMove, InCharacter, PC, OldStartLocation);
+
+	// The combined move is replayed from the pending move's start, the target rotation has to be rewound with the actor's
+	const FSavedMove_My* OldMoveMy = static_cast<const FSavedMove_My*>(OldMove);
+	if (AALSBaseCharacter* ALSCharacter = Cast<AALSBaseCharacter>(InCharacter))
+	{
+		ALSCharacter->SetTargetRotation(OldMoveMy->SavedTargetRotation);
+	}
+	SavedTargetRotation = OldMoveMy->SavedTargetRotation;
 }
 
 UALSCharacterMovementComponent::FNetworkPredictionData_Client_My::FNetworkPredictionData_Client_My(
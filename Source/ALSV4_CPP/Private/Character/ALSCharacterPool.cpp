@@ -0,0 +1,164 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#include "Character/ALSCharacterPool.h"
+
+#include "ALSLogChannels.h"
+#include "Character/ALSBaseCharacter.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "TimerManager.h"
+
+static TAutoConsoleVariable<int32> CVarCharacterPoolPrewarmCount(
+	TEXT("ALS.CharacterPool.PrewarmCount"),
+	4,
+	TEXT("Number of characters pre-warmed per pawn class when an experience loads. 0 disables pre-warming."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarCharacterPoolMaxPerClass(
+	TEXT("ALS.CharacterPool.MaxPerClass"),
+	8,
+	TEXT("Number of released characters kept per pawn class, characters released past this are destroyed. 0 disables pooling."),
+	ECVF_Default);
+
+UALSCharacterPool* UALSCharacterPool::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UALSCharacterPool>() : nullptr;
+}
+
+bool UALSCharacterPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UALSCharacterPool::Deinitialize()
+{
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PrewarmTimerHandle);
+	}
+
+	PendingPrewarms.Reset();
+	Pools.Reset();
+
+	Super::Deinitialize();
+}
+
+void UALSCharacterPool::PrewarmCharacters(TSubclassOf<AALSBaseCharacter> CharacterClass)
+{
+	if (!CharacterClass || CVarCharacterPoolPrewarmCount.GetValueOnGameThread() <= 0)
+	{
+		return;
+	}
+
+	PendingPrewarms.AddUnique(CharacterClass);
+
+	if (!PrewarmTimerHandle.IsValid())
+	{
+		PrewarmTimerHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::PrewarmNextCharacter);
+	}
+}
+
+void UALSCharacterPool::PrewarmNextCharacter()
+{
+	PrewarmTimerHandle.Invalidate();
+
+	const int32 PrewarmCount = FMath::Min(CVarCharacterPoolPrewarmCount.GetValueOnGameThread(), CVarCharacterPoolMaxPerClass.GetValueOnGameThread());
+
+	while (PendingPrewarms.Num() > 0)
+	{
+		const TSubclassOf<AALSBaseCharacter> CharacterClass = PendingPrewarms[0];
+		if (!CharacterClass || GetNumPooledCharacters(CharacterClass) >= PrewarmCount)
+		{
+			PendingPrewarms.RemoveAt(0);
+			continue;
+		}
+
+		// One character per frame, so pre-warming never becomes the spawn hitch it is meant to hide
+		if (AALSBaseCharacter* Character = SpawnPooledCharacter(CharacterClass))
+		{
+			Pools.FindOrAdd(CharacterClass).Characters.Add(Character);
+		}
+		else
+		{
+			PendingPrewarms.RemoveAt(0);
+		}
+
+		break;
+	}
+
+	if (PendingPrewarms.Num() > 0)
+	{
+		PrewarmTimerHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::PrewarmNextCharacter);
+	}
+}
+
+AALSBaseCharacter* UALSCharacterPool::SpawnPooledCharacter(TSubclassOf<AALSBaseCharacter> CharacterClass)
+{
+	FActorSpawnParameters SpawnInfo;
+	SpawnInfo.ObjectFlags |= RF_Transient;
+	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AALSBaseCharacter* Character = GetWorld()->SpawnActor<AALSBaseCharacter>(CharacterClass, FTransform::Identity, SpawnInfo);
+	if (!Character)
+	{
+		UE_LOG(LogALS, Error, TEXT("Character pool was unable to spawn a character of class [%s]."), *GetNameSafe(CharacterClass));
+		return nullptr;
+	}
+
+	Character->SetCharacterPooled(true);
+	return Character;
+}
+
+AALSBaseCharacter* UALSCharacterPool::AcquireCharacter(TSubclassOf<AALSBaseCharacter> CharacterClass, const FTransform& Transform)
+{
+	FALSPooledCharacters* Pool = Pools.Find(CharacterClass);
+	if (!Pool)
+	{
+		return nullptr;
+	}
+
+	while (Pool->Characters.Num() > 0)
+	{
+		AALSBaseCharacter* Character = Pool->Characters.Pop(false);
+		if (IsValid(Character))
+		{
+			Character->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+			Character->SetCharacterPooled(false);
+			return Character;
+		}
+	}
+
+	return nullptr;
+}
+
+void UALSCharacterPool::ReleaseCharacter(AALSBaseCharacter* Character)
+{
+	if (!IsValid(Character) || Character->IsCharacterPooled())
+	{
+		return;
+	}
+
+	if (AController* Controller = Character->GetController())
+	{
+		Controller->UnPossess();
+	}
+
+	FALSPooledCharacters& Pool = Pools.FindOrAdd(Character->GetClass());
+	if (Pool.Characters.Num() >= CVarCharacterPoolMaxPerClass.GetValueOnGameThread())
+	{
+		Character->Destroy();
+		return;
+	}
+
+	Character->ResetCharacterState();
+	Character->SetCharacterPooled(true);
+	Pool.Characters.Add(Character);
+}
+
+int32 UALSCharacterPool::GetNumPooledCharacters(TSubclassOf<AALSBaseCharacter> CharacterClass) const
+{
+	const FALSPooledCharacters* Pool = Pools.Find(CharacterClass);
+	return Pool ? Pool->Characters.Num() : 0;
+}
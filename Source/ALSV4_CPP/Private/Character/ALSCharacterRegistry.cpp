@@ -0,0 +1,58 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#include "Character/ALSCharacterRegistry.h"
+
+#include "Character/ALSBaseCharacter.h"
+#include "Engine/World.h"
+
+UALSCharacterRegistry* UALSCharacterRegistry::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UALSCharacterRegistry>() : nullptr;
+}
+
+int32 UALSCharacterRegistry::RegisterCharacter(AALSBaseCharacter* Character)
+{
+	check(Character);
+
+	const int32 RegistryIndex = Characters.Add(Character);
+	++RegistrySerial;
+	OnCharacterRegistered.Broadcast(Character);
+	return RegistryIndex;
+}
+
+void UALSCharacterRegistry::UnregisterCharacter(AALSBaseCharacter* Character, int32 RegistryIndex)
+{
+	if (!Characters.IsValidIndex(RegistryIndex) || Characters[RegistryIndex].Get() != Character)
+	{
+		return;
+	}
+
+	Characters.RemoveAt(RegistryIndex);
+	++RegistrySerial;
+	OnCharacterUnregistered.Broadcast(Character);
+}
+
+AALSBaseCharacter* UALSCharacterRegistry::GetCharacterAtIndex(int32 RegistryIndex) const
+{
+	return Characters.IsValidIndex(RegistryIndex) ? Characters[RegistryIndex].Get() : nullptr;
+}
+
+void UALSCharacterRegistry::GetRegisteredCharacters(TArray<AALSBaseCharacter*>& OutCharacters) const
+{
+	OutCharacters.Reset(Characters.Num());
+	ForEachCharacter([&OutCharacters](AALSBaseCharacter* Character)
+	{
+		OutCharacters.Add(Character);
+	});
+}
+
+void UALSCharacterRegistry::Deinitialize()
+{
+	Characters.Empty();
+	OnCharacterRegistered.Clear();
+	OnCharacterUnregistered.Clear();
+
+	Super::Deinitialize();
+}
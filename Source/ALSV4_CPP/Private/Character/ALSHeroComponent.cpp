@@ -237,14 +237,17 @@ void UALSHeroComponent::InitializePlayerInput(UInputComponent* PlayerInputCompon
 					LocalSettings->OnInputConfigDeactivated.AddUObject(this, &UALSHeroComponent::OnInputConfigDeactivated);
 				}
 
-				TArray<uint32> BindHandles;
-				ALSIC->BindAbilityActions(InputConfig, this, &ThisClass::Input_AbilityInputTagPressed, &ThisClass::Input_AbilityInputTagReleased, /*out*/ BindHandles);
+				const TArray<TALSNativeInputBinding<ThisClass>> NativeBindings =
+				{
+					{ GameplayTags.InputTag_Move, ETriggerEvent::Triggered, &ThisClass::Input_Move },
+					{ GameplayTags.InputTag_Look_Mouse, ETriggerEvent::Triggered, &ThisClass::Input_LookMouse },
+					{ GameplayTags.InputTag_Look_Stick, ETriggerEvent::Triggered, &ThisClass::Input_LookStick },
+					{ GameplayTags.InputTag_Crouch, ETriggerEvent::Triggered, &ThisClass::Input_Crouch },
+					{ GameplayTags.InputTag_AutoRun, ETriggerEvent::Triggered, &ThisClass::Input_AutoRun }
+				};
 
-				ALSIC->BindNativeAction(InputConfig, GameplayTags.InputTag_Move, ETriggerEvent::Triggered, this, &ThisClass::Input_Move, /*bLogIfNotFound=*/ true);
-				ALSIC->BindNativeAction(InputConfig, GameplayTags.InputTag_Look_Mouse, ETriggerEvent::Triggered, this, &ThisClass::Input_LookMouse, /*bLogIfNotFound=*/ true);
-				ALSIC->BindNativeAction(InputConfig, GameplayTags.InputTag_Look_Stick, ETriggerEvent::Triggered, this, &ThisClass::Input_LookStick, /*bLogIfNotFound=*/ true);
-				ALSIC->BindNativeAction(InputConfig, GameplayTags.InputTag_Crouch, ETriggerEvent::Triggered, this, &ThisClass::Input_Crouch, /*bLogIfNotFound=*/ true);
-				ALSIC->BindNativeAction(InputConfig, GameplayTags.InputTag_AutoRun, ETriggerEvent::Triggered, this, &ThisClass::Input_AutoRun, /*bLogIfNotFound=*/ true);
+				TArray<uint32> BindHandles;
+				ALSIC->BindAllActions(InputConfig, this, NativeBindings, &ThisClass::Input_AbilityInputTagPressed, &ThisClass::Input_AbilityInputTagReleased, /*out*/ BindHandles);
 				UE_LOG(LogTemp, Warning, TEXT("UALSHeroComponent::InitializePlayerInput - BindNativeAction"))
 			}
 		}
@@ -74,6 +74,16 @@ void UALSPawnExtensionComponent::SetPawnData(const UALSPawnData* InPawnData)
 	CheckPawnReadyToInitialize();
 }
 
+void UALSPawnExtensionComponent::ResetPawnData()
+{
+	UninitializeAbilitySystem();
+
+	PawnData = nullptr;
+	bPawnReadyToInitialize = false;
+
+	GetPawnChecked<APawn>()->ForceNetUpdate();
+}
+
 void UALSPawnExtensionComponent::OnRep_PawnData()
 {
 	CheckPawnReadyToInitialize();
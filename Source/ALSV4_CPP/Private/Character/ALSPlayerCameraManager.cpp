@@ -197,6 +197,7 @@ bool AALSPlayerCameraManager::CustomCameraBehavior(float DeltaTime, FVector& Loc
 	const bool bHit = World->SweepSingleByChannel(HitResult, TraceOrigin, TargetCameraLocation, FQuat::Identity,
 	                                              TraceChannel, SphereCollisionShape, Params);
 
+#if ENABLE_DRAW_DEBUG
 	if (ALSDebugComponent && ALSDebugComponent->GetShowTraces())
 	{
 		UALSDebugComponent::DrawDebugSphereTraceSingle(World,
@@ -210,6 +211,7 @@ bool AALSPlayerCameraManager::CustomCameraBehavior(float DeltaTime, FVector& Loc
 		                                               FLinearColor::Green,
 		                                               5.0f);
 	}
+#endif
 
 	if (HitResult.IsValidBlockingHit())
 	{
@@ -18,6 +18,7 @@ void AALSPlayerController::OnPossess(APawn* NewPawn)
 {
 	Super::OnPossess(NewPawn);
 	PossessedCharacter = Cast<AALSBaseCharacter>(NewPawn);
+	CacheNativeCharacterInputEvents();
 	if (!IsRunningDedicatedServer())
 	{
 		// Servers want to setup camera only in listen servers.
@@ -39,6 +40,7 @@ void AALSPlayerController::OnRep_Pawn()
 {
 	Super::OnRep_Pawn();
 	PossessedCharacter = Cast<AALSBaseCharacter>(GetPawn());
+	CacheNativeCharacterInputEvents();
 	SetupCamera();
 	SetupInputs();
 	
@@ -86,14 +88,101 @@ void AALSPlayerController::BindActions(UInputMappingContext* Context)
 			{
 				UniqueActions.Add(Keymapping.Action);
 			}
+			const TMap<FName, FInputActionHandler>& NativeHandlers = GetNativeInputActionHandlers();
 			for (const UInputAction* UniqueAction : UniqueActions)
 			{
-				EnhancedInputComponent->BindAction(UniqueAction, ETriggerEvent::Triggered, Cast<UObject>(this), UniqueAction->GetFName());
+				if (const FInputActionHandler* NativeHandler = NativeHandlers.Find(UniqueAction->GetFName()))
+				{
+					EnhancedInputComponent->BindAction(UniqueAction, ETriggerEvent::Triggered, this, *NativeHandler);
+				}
+				else
+				{
+					// Actions handled by functions of Blueprint or derived controllers
+					EnhancedInputComponent->BindAction(UniqueAction, ETriggerEvent::Triggered, Cast<UObject>(this), UniqueAction->GetFName());
+				}
 			}
 		}
 	}
 }
 
+const TMap<FName, AALSPlayerController::FInputActionHandler>& AALSPlayerController::GetNativeInputActionHandlers()
+{
+#define ALS_INPUT_ACTION_HANDLER(Name) { GET_FUNCTION_NAME_CHECKED(AALSPlayerController, Name), &AALSPlayerController::Name }
+
+	// Input actions are named after their handlers
+	static const TMap<FName, FInputActionHandler> Handlers =
+	{
+		ALS_INPUT_ACTION_HANDLER(ForwardMovementAction),
+		ALS_INPUT_ACTION_HANDLER(RightMovementAction),
+		ALS_INPUT_ACTION_HANDLER(CameraUpAction),
+		ALS_INPUT_ACTION_HANDLER(CameraRightAction),
+		ALS_INPUT_ACTION_HANDLER(JumpAction),
+		ALS_INPUT_ACTION_HANDLER(SprintAction),
+		ALS_INPUT_ACTION_HANDLER(AimAction),
+		ALS_INPUT_ACTION_HANDLER(CameraTapAction),
+		ALS_INPUT_ACTION_HANDLER(CameraHeldAction),
+		ALS_INPUT_ACTION_HANDLER(StanceAction),
+		ALS_INPUT_ACTION_HANDLER(WalkAction),
+		ALS_INPUT_ACTION_HANDLER(RagdollAction),
+		ALS_INPUT_ACTION_HANDLER(VelocityDirectionAction),
+		ALS_INPUT_ACTION_HANDLER(LookingDirectionAction),
+		ALS_INPUT_ACTION_HANDLER(DebugToggleHudAction),
+		ALS_INPUT_ACTION_HANDLER(DebugToggleDebugViewAction),
+		ALS_INPUT_ACTION_HANDLER(DebugToggleTracesAction),
+		ALS_INPUT_ACTION_HANDLER(DebugToggleShapesAction),
+		ALS_INPUT_ACTION_HANDLER(DebugToggleLayerColorsAction),
+		ALS_INPUT_ACTION_HANDLER(DebugToggleCharacterInfoAction),
+		ALS_INPUT_ACTION_HANDLER(DebugToggleSlomoAction),
+		ALS_INPUT_ACTION_HANDLER(DebugFocusedCharacterCycleAction),
+		ALS_INPUT_ACTION_HANDLER(DebugToggleMeshAction),
+		ALS_INPUT_ACTION_HANDLER(DebugOpenOverlayMenuAction),
+		ALS_INPUT_ACTION_HANDLER(DebugOverlayMenuCycleAction)
+	};
+
+#undef ALS_INPUT_ACTION_HANDLER
+
+	return Handlers;
+}
+
+void AALSPlayerController::CacheNativeCharacterInputEvents()
+{
+	NativeCharacterInputEvents = 0;
+
+	if (!PossessedCharacter)
+	{
+		return;
+	}
+
+	static const FName EventNames[] =
+	{
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, ForwardMovementAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, RightMovementAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, CameraUpAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, CameraRightAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, JumpAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, SprintAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, AimAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, CameraTapAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, CameraHeldAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, StanceAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, WalkAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, RagdollAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, VelocityDirectionAction),
+		GET_FUNCTION_NAME_CHECKED(AALSBaseCharacter, LookingDirectionAction)
+	};
+	static_assert(UE_ARRAY_COUNT(EventNames) == static_cast<int32>(ECharacterInputEvent::Num), "Every character input event needs a name");
+
+	// A Blueprint override replaces the native function of the event, the C++ implementation can then be called directly
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(EventNames); ++Index)
+	{
+		const UFunction* Function = PossessedCharacter->FindFunction(EventNames[Index]);
+		if (Function && Function->HasAnyFunctionFlags(FUNC_Native))
+		{
+			NativeCharacterInputEvents |= 1u << Index;
+		}
+	}
+}
+
 void AALSPlayerController::SetupInputs()
 {
 	if (PossessedCharacter)
@@ -128,7 +217,14 @@ void AALSPlayerController::ForwardMovementAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter)
 	{
-		PossessedCharacter->ForwardMovementAction(Value.GetMagnitude());
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::ForwardMovement))
+		{
+			PossessedCharacter->ForwardMovementAction_Implementation(Value.GetMagnitude());
+		}
+		else
+		{
+			PossessedCharacter->ForwardMovementAction(Value.GetMagnitude());
+		}
 	}
 }
 
@@ -136,7 +232,14 @@ void AALSPlayerController::RightMovementAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter)
 	{
-		PossessedCharacter->RightMovementAction(Value.GetMagnitude());
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::RightMovement))
+		{
+			PossessedCharacter->RightMovementAction_Implementation(Value.GetMagnitude());
+		}
+		else
+		{
+			PossessedCharacter->RightMovementAction(Value.GetMagnitude());
+		}
 	}
 }
 
@@ -144,7 +247,14 @@ void AALSPlayerController::CameraUpAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter)
 	{
-		PossessedCharacter->CameraUpAction(Value.GetMagnitude());
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::CameraUp))
+		{
+			PossessedCharacter->CameraUpAction_Implementation(Value.GetMagnitude());
+		}
+		else
+		{
+			PossessedCharacter->CameraUpAction(Value.GetMagnitude());
+		}
 	}
 }
 
@@ -152,7 +262,14 @@ void AALSPlayerController::CameraRightAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter)
 	{
-		PossessedCharacter->CameraRightAction(Value.GetMagnitude());
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::CameraRight))
+		{
+			PossessedCharacter->CameraRightAction_Implementation(Value.GetMagnitude());
+		}
+		else
+		{
+			PossessedCharacter->CameraRightAction(Value.GetMagnitude());
+		}
 	}
 }
 
@@ -160,7 +277,14 @@ void AALSPlayerController::JumpAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter)
 	{
-		PossessedCharacter->JumpAction(Value.Get<bool>());
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::Jump))
+		{
+			PossessedCharacter->JumpAction_Implementation(Value.Get<bool>());
+		}
+		else
+		{
+			PossessedCharacter->JumpAction(Value.Get<bool>());
+		}
 	}
 }
 
@@ -168,7 +292,14 @@ void AALSPlayerController::SprintAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter)
 	{
-		PossessedCharacter->SprintAction(Value.Get<bool>());
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::Sprint))
+		{
+			PossessedCharacter->SprintAction_Implementation(Value.Get<bool>());
+		}
+		else
+		{
+			PossessedCharacter->SprintAction(Value.Get<bool>());
+		}
 	}
 }
 
@@ -176,7 +307,14 @@ void AALSPlayerController::AimAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter)
 	{
-		PossessedCharacter->AimAction(Value.Get<bool>());
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::Aim))
+		{
+			PossessedCharacter->AimAction_Implementation(Value.Get<bool>());
+		}
+		else
+		{
+			PossessedCharacter->AimAction(Value.Get<bool>());
+		}
 	}
 }
 
@@ -184,7 +322,14 @@ void AALSPlayerController::CameraTapAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter)
 	{
-		PossessedCharacter->CameraTapAction();
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::CameraTap))
+		{
+			PossessedCharacter->CameraTapAction_Implementation();
+		}
+		else
+		{
+			PossessedCharacter->CameraTapAction();
+		}
 	}
 }
 
@@ -192,7 +337,14 @@ void AALSPlayerController::CameraHeldAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter)
 	{
-		PossessedCharacter->CameraHeldAction();
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::CameraHeld))
+		{
+			PossessedCharacter->CameraHeldAction_Implementation();
+		}
+		else
+		{
+			PossessedCharacter->CameraHeldAction();
+		}
 	}
 }
 
@@ -200,7 +352,14 @@ void AALSPlayerController::StanceAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter && Value.Get<bool>())
 	{
-		PossessedCharacter->StanceAction();
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::Stance))
+		{
+			PossessedCharacter->StanceAction_Implementation();
+		}
+		else
+		{
+			PossessedCharacter->StanceAction();
+		}
 	}
 }
 
@@ -208,7 +367,14 @@ void AALSPlayerController::WalkAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter && Value.Get<bool>())
 	{
-		PossessedCharacter->WalkAction();
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::Walk))
+		{
+			PossessedCharacter->WalkAction_Implementation();
+		}
+		else
+		{
+			PossessedCharacter->WalkAction();
+		}
 	}
 }
 
@@ -216,7 +382,14 @@ void AALSPlayerController::RagdollAction(const FInputActionValue& Value)
 {
 	if (PossessedCharacter && Value.Get<bool>())
 	{
-		PossessedCharacter->RagdollAction();
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::Ragdoll))
+		{
+			PossessedCharacter->RagdollAction_Implementation();
+		}
+		else
+		{
+			PossessedCharacter->RagdollAction();
+		}
 	}
 }
 
@@ -224,7 +397,14 @@ void AALSPlayerController::VelocityDirectionAction(const FInputActionValue& Valu
 {
 	if (PossessedCharacter && Value.Get<bool>())
 	{
-		PossessedCharacter->VelocityDirectionAction();
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::VelocityDirection))
+		{
+			PossessedCharacter->VelocityDirectionAction_Implementation();
+		}
+		else
+		{
+			PossessedCharacter->VelocityDirectionAction();
+		}
 	}
 }
 
@@ -232,7 +412,14 @@ void AALSPlayerController::LookingDirectionAction(const FInputActionValue& Value
 {
 	if (PossessedCharacter && Value.Get<bool>())
 	{
-		PossessedCharacter->LookingDirectionAction();
+		if (IsNativeCharacterInputEvent(ECharacterInputEvent::LookingDirection))
+		{
+			PossessedCharacter->LookingDirectionAction_Implementation();
+		}
+		else
+		{
+			PossessedCharacter->LookingDirectionAction();
+		}
 	}
 }
 
@@ -494,6 +494,7 @@ void UALSCharacterAnimInstance::SetFootOffsets(float DeltaSeconds, FName EnableF
 	                                                  TraceEnd,
 	                                                  ECC_Visibility, Params);
 
+#if ENABLE_DRAW_DEBUG
 	if (ALSDebugComponent && ALSDebugComponent->GetShowTraces())
 	{
 		UALSDebugComponent::DrawDebugLineTraceSingle(
@@ -507,6 +508,7 @@ void UALSCharacterAnimInstance::SetFootOffsets(float DeltaSeconds, FName EnableF
 			FLinearColor::Green,
 			5.0f);
 	}
+#endif
 
 	FRotator TargetRotOffset = FRotator::ZeroRotator;
 	if (Character->GetCharacterMovement()->IsWalkable(HitResult))
@@ -818,6 +820,7 @@ float UALSCharacterAnimInstance::CalculateLandPrediction() const
 	const bool bHit = World->SweepSingleByChannel(HitResult, CapsuleWorldLoc, CapsuleWorldLoc + TraceLength, FQuat::Identity,
 	                                              ECC_Visibility, CapsuleCollisionShape, Params);
 
+#if ENABLE_DRAW_DEBUG
 	if (ALSDebugComponent && ALSDebugComponent->GetShowTraces())
 	{
 		UALSDebugComponent::DrawDebugCapsuleTraceSingle(World,
@@ -831,6 +834,7 @@ float UALSCharacterAnimInstance::CalculateLandPrediction() const
 		                                                FLinearColor::Green,
 		                                                5.0f);
 	}
+#endif
 
 	if (Character->GetCharacterMovement()->IsWalkable(HitResult))
 	{
@@ -5,16 +5,14 @@
 
 
 #include "Character/ALSBaseCharacter.h"
+#include "Character/ALSCharacterRegistry.h"
 #include "Character/ALSPlayerCameraManager.h"
+#include "Character/Animation/ALSCharacterAnimInstance.h"
 #include "Character/Animation/ALSPlayerCameraBehavior.h"
+#include "Components/ALSDebugSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 
-bool UALSDebugComponent::bDebugView = false;
-bool UALSDebugComponent::bShowTraces = false;
-bool UALSDebugComponent::bShowDebugShapes = false;
-bool UALSDebugComponent::bShowLayerColors = false;
-
 UALSDebugComponent::UALSDebugComponent()
 {
 #if UE_BUILD_SHIPPING
@@ -22,6 +20,8 @@ UALSDebugComponent::UALSDebugComponent()
 #else
 	PrimaryComponentTick.bCanEverTick = true;
 #endif
+	// Only ticks while a debug visualization is active or a Blueprint subclass ticks, see RefreshDebugState
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UALSDebugComponent::TickComponent(float DeltaTime, ELevelTick TickType,
@@ -30,27 +30,18 @@ void UALSDebugComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 #if !UE_BUILD_SHIPPING
-	if (!OwnerCharacter)
+	// Still ticking for a Blueprint subclass, skip the native visualization
+	if (!OwnerCharacter || !DebugSubsystem || !DebugSubsystem->IsAnyVisualizationActive())
 	{
 		return;
 	}
 
-	if (bNeedsColorReset)
-	{
-		bNeedsColorReset = false;
-		SetResetColors();
-	}
-
-	if (bShowLayerColors)
-	{
-		UpdateColoringSystem();
-	}
-	else
+	if (DebugSubsystem->GetShowLayerColors())
 	{
-		bNeedsColorReset = true;
+		UpdateLayerColors();
 	}
 
-	if (bShowDebugShapes)
+	if (DebugSubsystem->GetShowDebugShapes())
 	{
 		DrawDebugSpheres();
 
@@ -67,17 +58,6 @@ void UALSDebugComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 #endif
 }
 
-void UALSDebugComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
-{
-	Super::OnComponentDestroyed(bDestroyingHierarchy);
-
-	// Keep static values false on destroy
-	bDebugView = false;
-	bShowTraces = false;
-	bShowDebugShapes = false;
-	bShowLayerColors = false;
-}
-
 void UALSDebugComponent::FocusedDebugCharacterCycle(bool bValue)
 {
 	// Refresh list, so we can also debug runtime spawned characters & remove despawned characters back
@@ -115,6 +95,9 @@ void UALSDebugComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	DebugSubsystem = UALSDebugSubsystem::Get(this);
+	bHasBlueprintTick = GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UALSDebugComponent, ReceiveTick));
+
 	OwnerCharacter = Cast<AALSBaseCharacter>(GetOwner());
 	DebugFocusCharacter = OwnerCharacter;
 	if (OwnerCharacter)
@@ -122,32 +105,99 @@ void UALSDebugComponent::BeginPlay()
 		SetDynamicMaterials();
 		SetResetColors();
 	}
+
+	if (DebugSubsystem)
+	{
+		DebugStateChangedHandle = DebugSubsystem->OnDebugStateChanged.AddUObject(
+			this, &UALSDebugComponent::RefreshDebugState);
+		RefreshDebugState();
+	}
+	else
+	{
+		SetComponentTickEnabled(bHasBlueprintTick);
+	}
+}
+
+void UALSDebugComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (DebugSubsystem)
+	{
+		DebugSubsystem->OnDebugStateChanged.Remove(DebugStateChangedHandle);
+		DebugStateChangedHandle.Reset();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UALSDebugComponent::RefreshDebugState()
+{
+	if (!DebugSubsystem)
+	{
+		return;
+	}
+
+	const bool bShowLayerColors = DebugSubsystem->GetShowLayerColors();
+	if (bNeedsColorReset && !bShowLayerColors && OwnerCharacter)
+	{
+		// Layer colors got switched off, restore the default colors once
+		SetResetColors();
+	}
+	bNeedsColorReset = bShowLayerColors;
+
+	// Forget the last pushed values, so the next update pushes everything again
+	bHasPushedLayerBlending = false;
+
+	// No per-frame work left, stop paying for the tick unless a Blueprint subclass needs it
+	SetComponentTickEnabled(bHasBlueprintTick || (OwnerCharacter && DebugSubsystem->IsAnyVisualizationActive()));
+}
+
+void UALSDebugComponent::UpdateLayerColors()
+{
+	const UALSCharacterAnimInstance* AnimInstance = Cast<UALSCharacterAnimInstance>(
+		OwnerCharacter->GetMesh()->GetAnimInstance());
+	if (AnimInstance)
+	{
+		// Layer colors only depend on the layer blending values, skip the update if none of them changed
+		if (bHasPushedLayerBlending && AnimInstance->LayerBlendingValues.Equals(LastPushedLayerBlending))
+		{
+			return;
+		}
+
+		LastPushedLayerBlending = AnimInstance->LayerBlendingValues;
+		bHasPushedLayerBlending = true;
+	}
+
+	UpdateColoringSystem();
 }
 
 void UALSDebugComponent::DetectDebuggableCharactersInWorld()
 {
 	// Get all ALSBaseCharacter's, which are currently present to show them later in the ALS HUD for debugging purposes.
-	TArray<AActor*> AlsBaseCharacters;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AALSBaseCharacter::StaticClass(), AlsBaseCharacters);
+	// Characters register themselves to the registry, so there is no need to walk every actor in the world.
+	const UALSCharacterRegistry* Registry = UALSCharacterRegistry::Get(this);
+	if (!Registry)
+	{
+		AvailableDebugCharacters.Empty();
+		FocusedDebugCharacterIndex = INDEX_NONE;
+		return;
+	}
 
-	AvailableDebugCharacters.Empty();
-	if (AlsBaseCharacters.Num() > 0)
+	if (Registry->GetRegistrySerial() != CachedRegistrySerial)
 	{
-		AvailableDebugCharacters.Reserve(AlsBaseCharacters.Num());
-		for (AActor* Character : AlsBaseCharacters)
+		// Only rebuild the list when a character was spawned or despawned since the last refresh
+		CachedRegistrySerial = Registry->GetRegistrySerial();
+		AvailableDebugCharacters.Reset(Registry->GetNumRegisteredCharacters());
+		Registry->ForEachCharacter([this](AALSBaseCharacter* Character)
 		{
-			if (AALSBaseCharacter* AlsBaseCharacter = Cast<AALSBaseCharacter>(Character))
-			{
-				AvailableDebugCharacters.Add(AlsBaseCharacter);
-			}
-		}
+			AvailableDebugCharacters.Add(Character);
+		});
+	}
 
-		FocusedDebugCharacterIndex = AvailableDebugCharacters.Find(DebugFocusCharacter);
-		if (FocusedDebugCharacterIndex == INDEX_NONE && AvailableDebugCharacters.Num() > 0)
-		{ // seems to be that this component was not attached to and AALSBaseCharacter,
-			// therefore the index will be set to the first element in the array.
-			FocusedDebugCharacterIndex = 0;
-		}
+	FocusedDebugCharacterIndex = AvailableDebugCharacters.Find(DebugFocusCharacter);
+	if (FocusedDebugCharacterIndex == INDEX_NONE && AvailableDebugCharacters.Num() > 0)
+	{ // seems to be that this component was not attached to and AALSBaseCharacter,
+		// therefore the index will be set to the first element in the array.
+		FocusedDebugCharacterIndex = 0;
 	}
 }
 
@@ -167,7 +217,13 @@ void UALSDebugComponent::ToggleSlomo()
 
 void UALSDebugComponent::ToggleDebugView()
 {
-	bDebugView = !bDebugView;
+	if (!DebugSubsystem)
+	{
+		return;
+	}
+
+	const bool bDebugView = !DebugSubsystem->GetDebugView();
+	DebugSubsystem->SetDebugView(bDebugView);
 
 	AALSPlayerCameraManager* CamManager = Cast<AALSPlayerCameraManager>(
 		UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0));
@@ -182,6 +238,50 @@ void UALSDebugComponent::ToggleDebugView()
 	}
 }
 
+void UALSDebugComponent::ToggleTraces()
+{
+	if (DebugSubsystem)
+	{
+		DebugSubsystem->SetShowTraces(!DebugSubsystem->GetShowTraces());
+	}
+}
+
+void UALSDebugComponent::ToggleDebugShapes()
+{
+	if (DebugSubsystem)
+	{
+		DebugSubsystem->SetShowDebugShapes(!DebugSubsystem->GetShowDebugShapes());
+	}
+}
+
+void UALSDebugComponent::ToggleLayerColors()
+{
+	if (DebugSubsystem)
+	{
+		DebugSubsystem->SetShowLayerColors(!DebugSubsystem->GetShowLayerColors());
+	}
+}
+
+bool UALSDebugComponent::GetDebugView() const
+{
+	return DebugSubsystem && DebugSubsystem->GetDebugView();
+}
+
+bool UALSDebugComponent::GetShowTraces() const
+{
+	return DebugSubsystem && DebugSubsystem->GetShowTraces();
+}
+
+bool UALSDebugComponent::GetShowDebugShapes() const
+{
+	return DebugSubsystem && DebugSubsystem->GetShowDebugShapes();
+}
+
+bool UALSDebugComponent::GetShowLayerColors() const
+{
+	return DebugSubsystem && DebugSubsystem->GetShowLayerColors();
+}
+
 void UALSDebugComponent::OpenOverlayMenu_Implementation(bool bValue)
 {
 }
@@ -217,7 +317,9 @@ void UALSDebugComponent::DrawDebugLineTraceSingle(const UWorld* World,
 	                                                FLinearColor TraceHitColor,
 	                                                float DrawTime)
 {
-	if (DrawDebugType != EDrawDebugTrace::None)
+#if ENABLE_DRAW_DEBUG
+	UALSDebugSubsystem* DebugDraw = UALSDebugSubsystem::Get(World);
+	if (DebugDraw && DrawDebugType != EDrawDebugTrace::None)
 	{
 		bool bPersistent = DrawDebugType == EDrawDebugTrace::Persistent;
 		float LifeTime = (DrawDebugType == EDrawDebugTrace::ForDuration) ? DrawTime : 0.f;
@@ -225,16 +327,17 @@ void UALSDebugComponent::DrawDebugLineTraceSingle(const UWorld* World,
 		if (bHit && OutHit.bBlockingHit)
 		{
 			// Red up to the blocking hit, green thereafter
-			DrawDebugLine(World, Start, OutHit.ImpactPoint, TraceColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugLine(World, OutHit.ImpactPoint, End, TraceHitColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugPoint(World, OutHit.ImpactPoint, 16.0f, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddLine(Start, OutHit.ImpactPoint, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddLine(OutHit.ImpactPoint, End, TraceHitColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddPoint(OutHit.ImpactPoint, 16.0f, TraceColor.ToFColor(true), bPersistent, LifeTime);
 		}
 		else
 		{
 			// no hit means all red
-			DrawDebugLine(World, Start, End, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddLine(Start, End, TraceColor.ToFColor(true), bPersistent, LifeTime);
 		}
 	}
+#endif
 }
 
 void UALSDebugComponent::DrawDebugCapsuleTraceSingle(const UWorld* World,
@@ -248,7 +351,9 @@ void UALSDebugComponent::DrawDebugCapsuleTraceSingle(const UWorld* World,
 	                                                   FLinearColor TraceHitColor,
 	                                                   float DrawTime)
 {
-	if (DrawDebugType != EDrawDebugTrace::None)
+#if ENABLE_DRAW_DEBUG
+	UALSDebugSubsystem* DebugDraw = UALSDebugSubsystem::Get(World);
+	if (DebugDraw && DrawDebugType != EDrawDebugTrace::None)
 	{
 		bool bPersistent = DrawDebugType == EDrawDebugTrace::Persistent;
 		float LifeTime = (DrawDebugType == EDrawDebugTrace::ForDuration) ? DrawTime : 0.f;
@@ -256,32 +361,33 @@ void UALSDebugComponent::DrawDebugCapsuleTraceSingle(const UWorld* World,
 		if (bHit && OutHit.bBlockingHit)
 		{
 			// Red up to the blocking hit, green thereafter
-			DrawDebugCapsule(World, Start, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugCapsule(World, OutHit.Location, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugLine(World, Start, OutHit.Location, TraceColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugPoint(World, OutHit.ImpactPoint, 16.0f, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddCapsule(Start, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddCapsule(OutHit.Location, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddLine(Start, OutHit.Location, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddPoint(OutHit.ImpactPoint, 16.0f, TraceColor.ToFColor(true), bPersistent, LifeTime);
 
-			DrawDebugCapsule(World, End, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceHitColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugLine(World, OutHit.Location, End, TraceHitColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddCapsule(End, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceHitColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddLine(OutHit.Location, End, TraceHitColor.ToFColor(true), bPersistent, LifeTime);
 		}
 		else
 		{
 			// no hit means all red
-			DrawDebugCapsule(World, Start, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugCapsule(World, End, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugLine(World, Start, End, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddCapsule(Start, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddCapsule(End, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(), FQuat::Identity, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddLine(Start, End, TraceColor.ToFColor(true), bPersistent, LifeTime);
 		}
 	}
+#endif
 }
 
-static void DrawDebugSweptSphere(const UWorld* InWorld,
+#if ENABLE_DRAW_DEBUG
+static void DrawDebugSweptSphere(UALSDebugSubsystem* DebugDraw,
 	                        FVector const& Start,
 	                        FVector const& End,
 	                        float Radius,
 	                        FColor const& Color,
 	                        bool bPersistentLines = false,
-	                        float LifeTime = -1.f,
-	                        uint8 DepthPriority = 0)
+	                        float LifeTime = -1.f)
 {
 	FVector const TraceVec = End - Start;
 	float const Dist = TraceVec.Size();
@@ -290,8 +396,9 @@ static void DrawDebugSweptSphere(const UWorld* InWorld,
 	float const HalfHeight = (Dist * 0.5f) + Radius;
 
 	FQuat const CapsuleRot = FRotationMatrix::MakeFromZ(TraceVec).ToQuat();
-	DrawDebugCapsule(InWorld, Center, HalfHeight, Radius, CapsuleRot, Color, bPersistentLines, LifeTime, DepthPriority);
+	DebugDraw->AddCapsule(Center, HalfHeight, Radius, CapsuleRot, Color, bPersistentLines, LifeTime);
 }
+#endif
 
 void UALSDebugComponent::DrawDebugSphereTraceSingle(const UWorld* World,
 	                                                  const FVector& Start,
@@ -304,7 +411,9 @@ void UALSDebugComponent::DrawDebugSphereTraceSingle(const UWorld* World,
 	                                                  FLinearColor TraceHitColor,
 	                                                  float DrawTime)
 {
-	if (DrawDebugType != EDrawDebugTrace::None)
+#if ENABLE_DRAW_DEBUG
+	UALSDebugSubsystem* DebugDraw = UALSDebugSubsystem::Get(World);
+	if (DebugDraw && DrawDebugType != EDrawDebugTrace::None)
 	{
 		bool bPersistent = DrawDebugType == EDrawDebugTrace::Persistent;
 		float LifeTime = (DrawDebugType == EDrawDebugTrace::ForDuration) ? DrawTime : 0.f;
@@ -312,14 +421,15 @@ void UALSDebugComponent::DrawDebugSphereTraceSingle(const UWorld* World,
 		if (bHit && OutHit.bBlockingHit)
 		{
 			// Red up to the blocking hit, green thereafter
-			DrawDebugSweptSphere(World, Start, OutHit.Location, CollisionShape.GetSphereRadius(), TraceColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugSweptSphere(World, OutHit.Location, End, CollisionShape.GetSphereRadius(), TraceHitColor.ToFColor(true), bPersistent, LifeTime);
-			DrawDebugPoint(World, OutHit.ImpactPoint, 16.0f, TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DrawDebugSweptSphere(DebugDraw, Start, OutHit.Location, CollisionShape.GetSphereRadius(), TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DrawDebugSweptSphere(DebugDraw, OutHit.Location, End, CollisionShape.GetSphereRadius(), TraceHitColor.ToFColor(true), bPersistent, LifeTime);
+			DebugDraw->AddPoint(OutHit.ImpactPoint, 16.0f, TraceColor.ToFColor(true), bPersistent, LifeTime);
 		}
 		else
 		{
 			// no hit means all red
-			DrawDebugSweptSphere(World, Start, End, CollisionShape.GetSphereRadius(), TraceColor.ToFColor(true), bPersistent, LifeTime);
+			DrawDebugSweptSphere(DebugDraw, Start, End, CollisionShape.GetSphereRadius(), TraceColor.ToFColor(true), bPersistent, LifeTime);
 		}
 	}
-}
\ No newline at end of file
+#endif
+}
@@ -0,0 +1,184 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#include "Components/ALSDebugSubsystem.h"
+
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+
+namespace ALSDebugDraw
+{
+	/** Same side count DrawDebugCapsule uses */
+	static constexpr int32 CapsuleSides = 16;
+}
+
+UALSDebugSubsystem* UALSDebugSubsystem::Get(const UObject* WorldContextObject)
+{
+#if ENABLE_DRAW_DEBUG
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UALSDebugSubsystem>() : nullptr;
+#else
+	return nullptr;
+#endif
+}
+
+bool UALSDebugSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if ENABLE_DRAW_DEBUG
+	return Super::ShouldCreateSubsystem(Outer);
+#else
+	return false;
+#endif
+}
+
+void UALSDebugSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(
+		this, &UALSDebugSubsystem::HandleWorldPostActorTick);
+}
+
+void UALSDebugSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PostActorTickHandle.Reset();
+
+	PendingLines.Empty();
+	PendingPoints.Empty();
+	PendingPersistentLines.Empty();
+	PendingPersistentPoints.Empty();
+
+	OnDebugStateChanged.Clear();
+
+	Super::Deinitialize();
+}
+
+void UALSDebugSubsystem::SetDebugFlag(bool& bFlag, bool bValue)
+{
+	if (bFlag != bValue)
+	{
+		bFlag = bValue;
+		OnDebugStateChanged.Broadcast();
+	}
+}
+
+void UALSDebugSubsystem::AddLine(const FVector& Start, const FVector& End, const FColor& Color, bool bPersistent,
+                                 float LifeTime, float Thickness)
+{
+	if (bPersistent || LifeTime > 0.0f)
+	{
+		PendingPersistentLines.Emplace(Start, End, Color, bPersistent ? -1.0f : LifeTime, Thickness, SDPG_World);
+	}
+	else
+	{
+		const ULineBatchComponent* LineBatcher = GetWorld()->LineBatcher;
+		PendingLines.Emplace(Start, End, Color, LineBatcher ? LineBatcher->DefaultLifeTime : 0.0f, Thickness, SDPG_World);
+	}
+}
+
+void UALSDebugSubsystem::AddPoint(const FVector& Position, float Size, const FColor& Color, bool bPersistent,
+                                  float LifeTime)
+{
+	if (bPersistent || LifeTime > 0.0f)
+	{
+		PendingPersistentPoints.Emplace(Position, Color, Size, bPersistent ? -1.0f : LifeTime, SDPG_World);
+	}
+	else
+	{
+		const ULineBatchComponent* LineBatcher = GetWorld()->LineBatcher;
+		PendingPoints.Emplace(Position, Color, Size, LineBatcher ? LineBatcher->DefaultLifeTime : 0.0f, SDPG_World);
+	}
+}
+
+void UALSDebugSubsystem::AddCapsule(const FVector& Center, float HalfHeight, float Radius, const FQuat& Rotation,
+                                    const FColor& Color, bool bPersistent, float LifeTime)
+{
+	// Mirrors the layout of DrawDebugCapsule, but feeds the lines into the batch buffer
+	const FVector XAxis = Rotation.GetAxisX();
+	const FVector YAxis = Rotation.GetAxisY();
+	const FVector ZAxis = Rotation.GetAxisZ();
+
+	const float HalfAxis = FMath::Max<float>(HalfHeight - Radius, 1.0f);
+	const FVector TopEnd = Center + HalfAxis * ZAxis;
+	const FVector BottomEnd = Center - HalfAxis * ZAxis;
+
+	// Top and bottom circles
+	AddArc(TopEnd, XAxis, YAxis, Radius, ALSDebugDraw::CapsuleSides, 2.0f * PI, Color, bPersistent, LifeTime);
+	AddArc(BottomEnd, XAxis, YAxis, Radius, ALSDebugDraw::CapsuleSides, 2.0f * PI, Color, bPersistent, LifeTime);
+
+	// Domed caps
+	AddArc(TopEnd, YAxis, ZAxis, Radius, ALSDebugDraw::CapsuleSides / 2, PI, Color, bPersistent, LifeTime);
+	AddArc(TopEnd, XAxis, ZAxis, Radius, ALSDebugDraw::CapsuleSides / 2, PI, Color, bPersistent, LifeTime);
+	AddArc(BottomEnd, YAxis, -ZAxis, Radius, ALSDebugDraw::CapsuleSides / 2, PI, Color, bPersistent, LifeTime);
+	AddArc(BottomEnd, XAxis, -ZAxis, Radius, ALSDebugDraw::CapsuleSides / 2, PI, Color, bPersistent, LifeTime);
+
+	// Connecting lines
+	AddLine(TopEnd + Radius * XAxis, BottomEnd + Radius * XAxis, Color, bPersistent, LifeTime);
+	AddLine(TopEnd - Radius * XAxis, BottomEnd - Radius * XAxis, Color, bPersistent, LifeTime);
+	AddLine(TopEnd + Radius * YAxis, BottomEnd + Radius * YAxis, Color, bPersistent, LifeTime);
+	AddLine(TopEnd - Radius * YAxis, BottomEnd - Radius * YAxis, Color, bPersistent, LifeTime);
+}
+
+void UALSDebugSubsystem::AddArc(const FVector& Base, const FVector& X, const FVector& Y, float Radius, int32 NumSides,
+                                float Angle, const FColor& Color, bool bPersistent, float LifeTime)
+{
+	const float AngleDelta = Angle / NumSides;
+	FVector LastVertex = Base + X * Radius;
+
+	for (int32 SideIndex = 1; SideIndex <= NumSides; SideIndex++)
+	{
+		float Sin, Cos;
+		FMath::SinCos(&Sin, &Cos, AngleDelta * SideIndex);
+		const FVector Vertex = Base + (X * Cos + Y * Sin) * Radius;
+		AddLine(LastVertex, Vertex, Color, bPersistent, LifeTime);
+		LastVertex = Vertex;
+	}
+}
+
+void UALSDebugSubsystem::FlushDebugDraw()
+{
+	UWorld* World = GetWorld();
+	if (World && World->GetNetMode() != NM_DedicatedServer)
+	{
+		if (ULineBatchComponent* LineBatcher = World->LineBatcher)
+		{
+			if (PendingLines.Num() > 0)
+			{
+				LineBatcher->DrawLines(PendingLines);
+			}
+			if (PendingPoints.Num() > 0)
+			{
+				LineBatcher->BatchedPoints.Append(PendingPoints);
+				LineBatcher->MarkRenderStateDirty();
+			}
+		}
+
+		if (ULineBatchComponent* PersistentLineBatcher = World->PersistentLineBatcher)
+		{
+			if (PendingPersistentLines.Num() > 0)
+			{
+				PersistentLineBatcher->DrawLines(PendingPersistentLines);
+			}
+			if (PendingPersistentPoints.Num() > 0)
+			{
+				PersistentLineBatcher->BatchedPoints.Append(PendingPersistentPoints);
+				PersistentLineBatcher->MarkRenderStateDirty();
+			}
+		}
+	}
+
+	// Keep the allocations around, the same amount of primitives is usually requested next frame
+	PendingLines.Reset();
+	PendingPoints.Reset();
+	PendingPersistentLines.Reset();
+	PendingPersistentPoints.Reset();
+}
+
+void UALSDebugSubsystem::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld())
+	{
+		FlushDebugDraw();
+	}
+}
@@ -176,6 +176,7 @@ bool UALSMantleComponent::MantleCheck(const FALSMantleTraceSettings& TraceSettin
 		const bool bHit = World->SweepSingleByProfile(HitResult, TraceStart, TraceEnd, FQuat::Identity, MantleObjectDetectionProfile,
 	                                                  CapsuleCollisionShape, Params);
 
+#if ENABLE_DRAW_DEBUG
 		if (ALSDebugComponent && ALSDebugComponent->GetShowTraces())
 		{
 			UALSDebugComponent::DrawDebugCapsuleTraceSingle(World,
@@ -189,6 +190,7 @@ bool UALSMantleComponent::MantleCheck(const FALSMantleTraceSettings& TraceSettin
 			                                                FLinearColor::Black,
 			                                                1.0f);
 		}
+#endif
 	}
 
 	if (!HitResult.IsValidBlockingHit() || OwnerCharacter->GetCharacterMovement()->IsWalkable(HitResult))
@@ -223,6 +225,7 @@ bool UALSMantleComponent::MantleCheck(const FALSMantleTraceSettings& TraceSettin
 	                                                  WalkableSurfaceDetectionChannel, SphereCollisionShape,
 	                                                  Params);
 
+#if ENABLE_DRAW_DEBUG
 		if (ALSDebugComponent && ALSDebugComponent->GetShowTraces())
 		{
 			UALSDebugComponent::DrawDebugSphereTraceSingle(World,
@@ -236,6 +239,7 @@ bool UALSMantleComponent::MantleCheck(const FALSMantleTraceSettings& TraceSettin
 			                                               FLinearColor::Black,
 			                                               1.0f);
 		}
+#endif
 	}
 
 
@@ -5,11 +5,333 @@
 #include "GameModes/ALSExperienceManager.h"
 #include "Engine/AssetManager.h"
 #include "GameModes/ALSExperienceDefinition.h"
+#include "GameModes/ALSExperienceActionSet.h"
 #include "GameModes/ALSExperienceManager.h"
+#include "GameModes/ALSExperienceManagerComponent.h"
 #include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFeatureAction.h"
+#include "GameFeaturesSubsystem.h"
+#include "System/ALSAssetManager.h"
+#include "ALSLogChannels.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ALSExperienceManager)
 
+static TAutoConsoleVariable<int32> CVarExperiencePreloadBudgetMB(
+	TEXT("ALS.Experience.PreloadBudgetMB"),
+	256,
+	TEXT("Disk size in MB of the assets preloaded in the background for the current and the likely next experience. 0 disables preloading."),
+	ECVF_Default);
+
+void UALSExperienceManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	WorldInitializedActorsHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &ThisClass::HandleWorldInitializedActors);
+}
+
+void UALSExperienceManager::HandleWorldInitializedActors(const FActorsInitializedParams& Params)
+{
+	UWorld* World = Params.World;
+	if (PendingTransitions.Num() == 0 || World == nullptr || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	// Clients only know once the game state has replicated
+	if (AGameStateBase* GameState = World->GetGameState())
+	{
+		HandleGameStateSet(GameState);
+	}
+	else
+	{
+		World->GameStateSetEvent.AddUObject(this, &ThisClass::HandleGameStateSet);
+	}
+}
+
+void UALSExperienceManager::HandleGameStateSet(AGameStateBase* GameState)
+{
+	if (GameState == nullptr || GameState->FindComponentByClass<UALSExperienceManagerComponent>() != nullptr)
+	{
+		return;
+	}
+
+	if (const FWorldContext* WorldContext = GEngine->GetWorldContextFromWorld(GameState->GetWorld()))
+	{
+		if (PendingTransitions.Contains(WorldContext->ContextHandle))
+		{
+			UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: %s has no experience, releasing the one stashed during travel"), *GetNameSafe(GameState->GetWorld()));
+			FlushPendingTransition(WorldContext->ContextHandle);
+		}
+	}
+}
+
+void UALSExperienceManager::StashOutgoingExperience(FName WorldContextHandle, FALSExperienceTransitionState&& OutgoingState)
+{
+	// Only one experience per world context can be in transit at a time
+	FlushPendingTransition(WorldContextHandle);
+
+	const FALSExperienceTransitionState& PendingTransition = PendingTransitions.Add(WorldContextHandle, MoveTemp(OutgoingState));
+
+	UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: Stashed outgoing experience (%d plugins, %d actions, %d bundle assets) until the next one is known"),
+		PendingTransition.GameFeaturePluginURLs.Num(), PendingTransition.RegisteredActions.Num(), PendingTransition.BundleAssets.Num());
+}
+
+void UALSExperienceManager::ResolveTransition(FName WorldContextHandle, const TArray<FString>& IncomingPluginURLs, const TArray<UGameFeatureAction*>& IncomingActions,
+	const TArray<FPrimaryAssetId>& IncomingBundleAssets, TSet<UGameFeatureAction*>& OutRetainedActions)
+{
+	FALSExperienceTransitionState OutgoingState;
+	if (!PendingTransitions.RemoveAndCopyValue(WorldContextHandle, OutgoingState))
+	{
+		return;
+	}
+
+	int32 NumDeactivatedPlugins = 0;
+	for (const FString& PluginURL : OutgoingState.GameFeaturePluginURLs)
+	{
+		// Shared plugins stay active, the incoming experience requests them again
+		const bool bShared = IncomingPluginURLs.Contains(PluginURL);
+		if (RequestToDeactivatePlugin(PluginURL) && !bShared)
+		{
+			UGameFeaturesSubsystem::Get().DeactivateGameFeaturePlugin(PluginURL);
+			++NumDeactivatedPlugins;
+		}
+	}
+
+	for (UGameFeatureAction* Action : OutgoingState.RegisteredActions)
+	{
+		if (Action == nullptr)
+		{
+			continue;
+		}
+
+		if (IncomingActions.Contains(Action))
+		{
+			OutRetainedActions.Add(Action);
+		}
+		else
+		{
+			Action->OnGameFeatureUnregistering();
+		}
+	}
+
+	TArray<FPrimaryAssetId> AssetsToUnload;
+	for (const FPrimaryAssetId& AssetId : OutgoingState.BundleAssets)
+	{
+		if (!IncomingBundleAssets.Contains(AssetId))
+		{
+			AssetsToUnload.Add(AssetId);
+		}
+	}
+
+	if (AssetsToUnload.Num() > 0 && UAssetManager::IsValid())
+	{
+		UALSAssetManager::Get().ChangeBundleStateForPrimaryAssets(AssetsToUnload, {}, OutgoingState.Bundles);
+	}
+
+	UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: Transition kept %d actions registered, deactivated %d of %d plugins, unloaded %d of %d bundle assets"),
+		OutRetainedActions.Num(), NumDeactivatedPlugins, OutgoingState.GameFeaturePluginURLs.Num(), AssetsToUnload.Num(), OutgoingState.BundleAssets.Num());
+}
+
+void UALSExperienceManager::FlushPendingTransition(FName WorldContextHandle)
+{
+	TSet<UGameFeatureAction*> RetainedActions;
+	ResolveTransition(WorldContextHandle, {}, {}, {}, RetainedActions);
+}
+
+void UALSExperienceManager::SetNextExperienceHint(const FPrimaryAssetId& ExperienceId)
+{
+	NextExperienceHint = ExperienceId;
+}
+
+void UALSExperienceManager::StartPreloading(FName WorldContextHandle, const UALSExperienceDefinition* LoadedExperience, const TArray<FName>& ExperienceBundles)
+{
+	const FPrimaryAssetId NextExperienceId = NextExperienceHint.IsValid() ? NextExperienceHint : LoadedExperience->LikelyNextExperience;
+	NextExperienceHint = FPrimaryAssetId();
+
+	if (CVarExperiencePreloadBudgetMB.GetValueOnGameThread() <= 0)
+	{
+		return;
+	}
+
+	// Bundles the loaded experience didn't need right away, added on top of what it already loaded
+	if (LoadedExperience->PreloadBundles.Num() > 0)
+	{
+		RequestPreload(WorldContextHandle, LoadedExperience->GetPrimaryAssetId(), LoadedExperience->PreloadBundles, false);
+	}
+
+	for (const TObjectPtr<UALSExperienceActionSet>& ActionSet : LoadedExperience->ActionSets)
+	{
+		if (ActionSet != nullptr && ActionSet->PreloadBundles.Num() > 0)
+		{
+			RequestPreload(WorldContextHandle, ActionSet->GetPrimaryAssetId(), ActionSet->PreloadBundles, false);
+		}
+	}
+
+	if (NextExperienceId.IsValid() && NextExperienceId != LoadedExperience->GetPrimaryAssetId())
+	{
+		// Something else may hold the next experience already, eviction must not unload it then
+		const bool bOwnsPrimaryAsset = UALSAssetManager::Get().GetPrimaryAssetObject(NextExperienceId) == nullptr;
+		if (FPreload* Preload = RequestPreload(WorldContextHandle, NextExperienceId, ExperienceBundles, bOwnsPrimaryAsset))
+		{
+			// The action sets of the next experience are only known once its definition is in
+			const FStreamableDelegate OnPreloaded = FStreamableDelegate::CreateUObject(this, &ThisClass::OnNextExperiencePreloaded, WorldContextHandle, NextExperienceId, ExperienceBundles);
+			if (!Preload->Handle.IsValid() || Preload->Handle->HasLoadCompleted())
+			{
+				FStreamableHandle::ExecuteDelegate(OnPreloaded);
+			}
+			else
+			{
+				Preload->Handle->BindCompleteDelegate(OnPreloaded);
+			}
+		}
+	}
+}
+
+void UALSExperienceManager::OnNextExperiencePreloaded(FName WorldContextHandle, FPrimaryAssetId ExperienceId, TArray<FName> ExperienceBundles)
+{
+	UALSAssetManager& AssetManager = UALSAssetManager::Get();
+
+	// Experience definitions are Blueprint classes, the primary asset is the generated class
+	const TSubclassOf<UALSExperienceDefinition> ExperienceClass = AssetManager.GetPrimaryAssetObjectClass<UALSExperienceDefinition>(ExperienceId);
+	if (ExperienceClass == nullptr)
+	{
+		return;
+	}
+
+	const UALSExperienceDefinition* Experience = GetDefault<UALSExperienceDefinition>(ExperienceClass);
+
+	for (const TObjectPtr<UALSExperienceActionSet>& ActionSet : Experience->ActionSets)
+	{
+		// Action sets shared with the current experience are loaded already
+		if (ActionSet != nullptr && AssetManager.GetPrimaryAssetObject(ActionSet->GetPrimaryAssetId()) == nullptr)
+		{
+			RequestPreload(WorldContextHandle, ActionSet->GetPrimaryAssetId(), ExperienceBundles, true);
+		}
+	}
+}
+
+UALSExperienceManager::FPreload* UALSExperienceManager::RequestPreload(FName WorldContextHandle, const FPrimaryAssetId& AssetId, const TArray<FName>& Bundles, bool bOwnsPrimaryAsset)
+{
+	TArray<FPreload>& ContextPreloads = Preloads.FindOrAdd(WorldContextHandle);
+	if (ContextPreloads.ContainsByPredicate([&AssetId](const FPreload& Preload) { return Preload.AssetId == AssetId; }))
+	{
+		return nullptr;
+	}
+
+	const int64 EstimatedBytes = EstimatePreloadSize(AssetId, Bundles);
+	const int64 BudgetBytes = static_cast<int64>(CVarExperiencePreloadBudgetMB.GetValueOnGameThread()) * 1024 * 1024;
+	if (PreloadedBytes + EstimatedBytes > BudgetBytes)
+	{
+		UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: Skipped preloading %s (%.1f MB), it doesn't fit into the remaining budget of %.1f MB"),
+			*AssetId.ToString(), EstimatedBytes / (1024.0 * 1024.0), (BudgetBytes - PreloadedBytes) / (1024.0 * 1024.0));
+		return nullptr;
+	}
+
+	// Experiences load at high priority, preloads only use the bandwidth left over
+	UALSAssetManager& AssetManager = UALSAssetManager::Get();
+
+	FPreload& Preload = ContextPreloads.AddDefaulted_GetRef();
+	Preload.AssetId = AssetId;
+	Preload.Bundles = Bundles;
+	Preload.EstimatedBytes = EstimatedBytes;
+	Preload.bOwnsPrimaryAsset = bOwnsPrimaryAsset;
+	Preload.Handle = bOwnsPrimaryAsset
+		? AssetManager.LoadPrimaryAsset(AssetId, Bundles, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority)
+		: AssetManager.ChangeBundleStateForPrimaryAssets({ AssetId }, Bundles, {}, false, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority);
+
+	PreloadedBytes += EstimatedBytes;
+
+	UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: Preloading %s (%.1f MB)"), *AssetId.ToString(), EstimatedBytes / (1024.0 * 1024.0));
+
+	return &Preload;
+}
+
+int64 UALSExperienceManager::EstimatePreloadSize(const FPrimaryAssetId& AssetId, const TArray<FName>& Bundles) const
+{
+	UALSAssetManager& AssetManager = UALSAssetManager::Get();
+
+	TSet<FName> PackageNames;
+	PackageNames.Add(AssetManager.GetPrimaryAssetPath(AssetId).GetLongPackageFName());
+
+	for (const FName& Bundle : Bundles)
+	{
+		const FAssetBundleEntry BundleEntry = AssetManager.GetAssetBundleEntry(AssetId, Bundle);
+		for (const FSoftObjectPath& AssetPath : BundleEntry.BundleAssets)
+		{
+			PackageNames.Add(AssetPath.GetLongPackageFName());
+		}
+	}
+
+	int64 Bytes = 0;
+	for (const FName& PackageName : PackageNames)
+	{
+		const TOptional<FAssetPackageData> PackageData = AssetManager.GetAssetRegistry().GetAssetPackageDataCopy(PackageName);
+		if (PackageData.IsSet() && PackageData->DiskSize > 0)
+		{
+			Bytes += PackageData->DiskSize;
+		}
+	}
+
+	return Bytes;
+}
+
+void UALSExperienceManager::EvictUnusedPreloads(FName WorldContextHandle, const TArray<FPrimaryAssetId>& IncomingBundleAssets)
+{
+	TArray<FPreload> ContextPreloads;
+	if (!Preloads.RemoveAndCopyValue(WorldContextHandle, ContextPreloads) || ContextPreloads.Num() == 0)
+	{
+		return;
+	}
+
+	UALSAssetManager& AssetManager = UALSAssetManager::Get();
+
+	int32 NumEvicted = 0;
+	for (FPreload& Preload : ContextPreloads)
+	{
+		PreloadedBytes -= Preload.EstimatedBytes;
+
+		// Used preloads are taken over by the incoming experience, which requests its own bundles on top
+		if (IncomingBundleAssets.Contains(Preload.AssetId))
+		{
+			continue;
+		}
+
+		if (Preload.Handle.IsValid() && !Preload.Handle->HasLoadCompleted())
+		{
+			Preload.Handle->CancelHandle();
+		}
+
+		if (Preload.bOwnsPrimaryAsset)
+		{
+			AssetManager.UnloadPrimaryAsset(Preload.AssetId);
+		}
+		else
+		{
+			AssetManager.ChangeBundleStateForPrimaryAssets({ Preload.AssetId }, {}, Preload.Bundles);
+		}
+
+		++NumEvicted;
+	}
+
+	UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: Incoming experience used %d of %d preloads, evicted the rest"), ContextPreloads.Num() - NumEvicted, ContextPreloads.Num());
+}
+
+void UALSExperienceManager::Deinitialize()
+{
+	FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitializedActorsHandle);
+
+	// The process is going away, nothing left to unload
+	PendingTransitions.Empty();
+	Preloads.Empty();
+	PreloadedBytes = 0;
+
+	Super::Deinitialize();
+}
+
 #if WITH_EDITOR
 
 void UALSExperienceManager::OnPlayInEditorBegun()
@@ -11,16 +11,12 @@
 #include "GameFeaturesSubsystemSettings.h"
 #include "TimerManager.h"
 #include "ALSLogChannels.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ALSExperienceManagerComponent)
 
-//@TODO: Async load the experience definition itself
 //@TODO: Handle failures explicitly (go into a 'completed but failed' state rather than check()-ing)
-//@TODO: Do the action phases at the appropriate times instead of all at once
-//@TODO: Support deactivating an experience and do the unloading actions
 //@TODO: Think about what deactivation/cleanup means for preloaded assets
-//@TODO: Handle deactivating game features, right now we 'leak' them enabled
-// (for a client moving from experience to experience we actually want to diff the requirements and only unload some, not unload everything for them to just be immediately reloaded)
 //@TODO: Handle both built-in and URL-based plugins (search for colon?)
 
 namespace ALSConsoleVariables
@@ -39,6 +35,20 @@ namespace ALSConsoleVariables
 		TEXT("A random amount of time between 0 and this value (in seconds) will be added as a delay of load completion of the experience (along with the fixed value lyra.chaos.ExperienceDelayLoad.MinSecs)"),
 		ECVF_Default);
 
+	static bool bDifferentialExperienceTransitions = true;
+	static FAutoConsoleVariableRef CVarDifferentialExperienceTransitions(
+		TEXT("ALS.Experience.DifferentialTransitions"),
+		bDifferentialExperienceTransitions,
+		TEXT("When travelling between maps, only load, activate, deactivate and unload what differs between the outgoing and incoming experience."),
+		ECVF_Default);
+
+	static float ExperienceActionFrameBudgetMs = 4.0f;
+	static FAutoConsoleVariableRef CVarExperienceActionFrameBudgetMs(
+		TEXT("ALS.Experience.ActionFrameBudgetMs"),
+		ExperienceActionFrameBudgetMs,
+		TEXT("Milliseconds per frame spent registering, loading and activating experience actions, at least one action step runs each frame. 0 runs them all in one frame."),
+		ECVF_Default);
+
 	float GetExperienceLoadDelayDuration()
 	{
 		return FMath::Max(0.0f, ExperienceLoadRandomDelayMin + FMath::FRand() * ExperienceLoadRandomDelayRange);
@@ -54,18 +64,62 @@ UALSExperienceManagerComponent::UALSExperienceManagerComponent(const FObjectInit
 #if WITH_SERVER_CODE
 void UALSExperienceManagerComponent::ServerSetCurrentExperience(FPrimaryAssetId ExperienceId)
 {
-	UALSAssetManager& AssetManager = UALSAssetManager::Get();
-	FSoftObjectPath AssetPath = AssetManager.GetPrimaryAssetPath(ExperienceId);
-	TSubclassOf<UALSExperienceDefinition> AssetClass = Cast<UClass>(AssetPath.TryLoad());
-	check(AssetClass);
-	const UALSExperienceDefinition* Experience = GetDefault<UALSExperienceDefinition>(AssetClass);
+	check(ExperienceId.IsValid());
+	check(!CurrentExperienceId.IsValid());
+	CurrentExperienceId = ExperienceId;
+	StartExperienceDefinitionLoad();
+}
+#endif
 
-	check(Experience != nullptr);
+void UALSExperienceManagerComponent::StartExperienceDefinitionLoad()
+{
+	check(LoadState == EALSExperienceLoadState::Unloaded);
 	check(CurrentExperience == nullptr);
-	CurrentExperience = Experience;
+
+	UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: StartExperienceDefinitionLoad(ExperienceId = %s, %s)"),
+		*CurrentExperienceId.ToString(),
+		*GetClientServerContextString(this));
+
+	LoadState = EALSExperienceLoadState::LoadingDefinition;
+
+	UALSAssetManager& AssetManager = UALSAssetManager::Get();
+	const FSoftObjectPath AssetPath = AssetManager.GetPrimaryAssetPath(CurrentExperienceId);
+
+	FStreamableDelegate OnDefinitionLoadedDelegate = FStreamableDelegate::CreateUObject(this, &ThisClass::OnExperienceDefinitionLoaded);
+	ExperienceDefinitionHandle = AssetManager.GetStreamableManager().RequestAsyncLoad(AssetPath, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority, /*bManageActiveHandle=*/ false, /*bStartStalled=*/ false, TEXT("StartExperienceDefinitionLoad()"));
+
+	if (!ExperienceDefinitionHandle.IsValid() || ExperienceDefinitionHandle->HasLoadCompleted())
+	{
+		// Definition was already loaded, continue right away
+		FStreamableHandle::ExecuteDelegate(OnDefinitionLoadedDelegate);
+	}
+	else
+	{
+		ExperienceDefinitionHandle->BindCompleteDelegate(OnDefinitionLoadedDelegate);
+		ExperienceDefinitionHandle->BindCancelDelegate(OnDefinitionLoadedDelegate);
+	}
+}
+
+void UALSExperienceManagerComponent::OnExperienceDefinitionLoaded()
+{
+	if (LoadState != EALSExperienceLoadState::LoadingDefinition)
+	{
+		// Torn down while the definition was streaming in
+		return;
+	}
+
+	const FSoftObjectPath AssetPath = UALSAssetManager::Get().GetPrimaryAssetPath(CurrentExperienceId);
+	const TSubclassOf<UALSExperienceDefinition> AssetClass = Cast<UClass>(AssetPath.ResolveObject());
+	if (!ensureMsgf(AssetClass, TEXT("Failed to load experience definition %s"), *CurrentExperienceId.ToString()))
+	{
+		LoadState = EALSExperienceLoadState::Unloaded;
+		return;
+	}
+
+	CurrentExperience = GetDefault<UALSExperienceDefinition>(AssetClass);
+	LoadState = EALSExperienceLoadState::Unloaded;
 	StartExperienceLoad();
 }
-#endif
 
 void UALSExperienceManagerComponent::CallOrRegister_OnExperienceLoaded_HighPriority(FOnALSExperienceLoaded::FDelegate&& Delegate)
 {
@@ -115,9 +169,12 @@ bool UALSExperienceManagerComponent::IsExperienceLoaded() const
 	return (LoadState == EALSExperienceLoadState::Loaded) && (CurrentExperience != nullptr);
 }
 
-void UALSExperienceManagerComponent::OnRep_CurrentExperience()
+void UALSExperienceManagerComponent::OnRep_CurrentExperienceId()
 {
-	StartExperienceLoad();
+	if (CurrentExperienceId.IsValid())
+	{
+		StartExperienceDefinitionLoad();
+	}
 }
 
 void UALSExperienceManagerComponent::StartExperienceLoad()
@@ -145,6 +202,33 @@ void UALSExperienceManagerComponent::StartExperienceLoad()
 		}
 	}
 
+	// The plugin list is known as soon as the definition is, needed to diff against a previous experience
+	CollectGameFeaturePluginURLs();
+
+	// Release whatever the experience of the previous map used or preloaded and this one doesn't
+	if (UALSExperienceManager* ExperienceManager = GEngine->GetEngineSubsystem<UALSExperienceManager>())
+	{
+		TArray<UGameFeatureAction*> IncomingActions;
+		GetExperienceActions(IncomingActions);
+
+		const FWorldContext* WorldContext = GEngine->GetWorldContextFromWorld(GetWorld());
+
+		RetainedActions.Reset();
+		ExperienceManager->ResolveTransition(WorldContext ? WorldContext->ContextHandle : NAME_None, GameFeaturePluginURLs, IncomingActions, BundleAssetList.Array(), RetainedActions);
+		ExperienceManager->EvictUnusedPreloads(WorldContext ? WorldContext->ContextHandle : NAME_None, BundleAssetList.Array());
+	}
+
+	// Start loading and activating the features right away, they stream in alongside the experience's bundles
+	// and OnExperienceLoadComplete joins both before the actions run
+	ExperienceLoadStartTime = FPlatformTime::Seconds();
+	NumGameFeaturePluginsLoading = GameFeaturePluginURLs.Num();
+	for (const FString& PluginURL : GameFeaturePluginURLs)
+	{
+		UALSExperienceManager::NotifyOfPluginActivation(PluginURL);
+		ActivatedPluginURLs.Add(PluginURL);
+		UGameFeaturesSubsystem::Get().LoadAndActivateGameFeaturePlugin(PluginURL, FGameFeaturePluginLoadComplete::CreateUObject(this, &ThisClass::OnGameFeaturePluginLoadComplete));
+	}
+
 	// Load assets associated with the experience
 
 	TArray<FName> BundlesToLoad;
@@ -163,6 +247,9 @@ void UALSExperienceManagerComponent::StartExperienceLoad()
 		BundlesToLoad.Add(UGameFeaturesSubsystemSettings::LoadStateServer);
 	}
 
+	LoadedBundleAssets = BundleAssetList.Array();
+	LoadedBundles = BundlesToLoad;
+
 	const TSharedPtr<FStreamableHandle> BundleLoadHandle = AssetManager.ChangeBundleStateForPrimaryAssets(BundleAssetList.Array(), BundlesToLoad, {}, false, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
 	const TSharedPtr<FStreamableHandle> RawLoadHandle = AssetManager.LoadAssetList(RawAssetList.Array(), FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority, TEXT("StartExperienceLoad()"));
 
@@ -192,25 +279,10 @@ void UALSExperienceManagerComponent::StartExperienceLoad()
 				OnAssetsLoadedDelegate.ExecuteIfBound();
 			}));
 	}
-
-	// This set of assets gets preloaded, but we don't block the start of the experience based on it
-	TSet<FPrimaryAssetId> PreloadAssetList;
-	//@TODO: Determine assets to preload (but not blocking-ly)
-	if (PreloadAssetList.Num() > 0)
-	{
-		AssetManager.ChangeBundleStateForPrimaryAssets(PreloadAssetList.Array(), BundlesToLoad, {});
-	}
 }
 
-void UALSExperienceManagerComponent::OnExperienceLoadComplete()
+void UALSExperienceManagerComponent::CollectGameFeaturePluginURLs()
 {
-	check(LoadState == EALSExperienceLoadState::Loading);
-	check(CurrentExperience != nullptr);
-
-	UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: OnExperienceLoadComplete(CurrentExperience = %s, %s)"),
-		*CurrentExperience->GetPrimaryAssetId().ToString(),
-		*GetClientServerContextString(this));
-
 	// find the URLs for our GameFeaturePlugins - filtering out dupes and ones that don't have a valid mapping
 	GameFeaturePluginURLs.Reset();
 
@@ -225,7 +297,7 @@ void UALSExperienceManagerComponent::OnExperienceLoadComplete()
 			}
 			else
 			{
-				ensureMsgf(false, TEXT("OnExperienceLoadComplete failed to find plugin URL from PluginName %s for experience %s - fix data, ignoring for this run"), *PluginName, *Context->GetPrimaryAssetId().ToString());
+				ensureMsgf(false, TEXT("StartExperienceLoad failed to find plugin URL from PluginName %s for experience %s - fix data, ignoring for this run"), *PluginName, *Context->GetPrimaryAssetId().ToString());
 			}
 		}
 
@@ -248,18 +320,37 @@ void UALSExperienceManagerComponent::OnExperienceLoadComplete()
 			CollectGameFeaturePluginURLs(ActionSet, ActionSet->GameFeaturesToEnable);
 		}
 	}
+}
 
-	// Load and activate the features	
-	NumGameFeaturePluginsLoading = GameFeaturePluginURLs.Num();
-	if (NumGameFeaturePluginsLoading > 0)
+void UALSExperienceManagerComponent::GetExperienceActions(TArray<UGameFeatureAction*>& OutActions) const
+{
+	OutActions.Reset();
+	OutActions.Append(CurrentExperience->Actions);
+	for (const TObjectPtr<UALSExperienceActionSet>& ActionSet : CurrentExperience->ActionSets)
 	{
-		LoadState = EALSExperienceLoadState::LoadingGameFeatures;
-		for (const FString& PluginURL : GameFeaturePluginURLs)
+		if (ActionSet != nullptr)
 		{
-			UALSExperienceManager::NotifyOfPluginActivation(PluginURL);
-			UGameFeaturesSubsystem::Get().LoadAndActivateGameFeaturePlugin(PluginURL, FGameFeaturePluginLoadComplete::CreateUObject(this, &ThisClass::OnGameFeaturePluginLoadComplete));
+			OutActions.Append(ActionSet->Actions);
 		}
 	}
+}
+
+void UALSExperienceManagerComponent::OnExperienceLoadComplete()
+{
+	check(LoadState == EALSExperienceLoadState::Loading);
+	check(CurrentExperience != nullptr);
+
+	UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: OnExperienceLoadComplete(CurrentExperience = %s, %s) after %.2f ms, %d of %d game feature plugins still loading"),
+		*CurrentExperience->GetPrimaryAssetId().ToString(),
+		*GetClientServerContextString(this),
+		(FPlatformTime::Seconds() - ExperienceLoadStartTime) * 1000.0,
+		NumGameFeaturePluginsLoading, GameFeaturePluginURLs.Num());
+
+	// Wait for the features started in StartExperienceLoad
+	if (NumGameFeaturePluginsLoading > 0)
+	{
+		LoadState = EALSExperienceLoadState::LoadingGameFeatures;
+	}
 	else
 	{
 		OnExperienceFullLoadCompleted();
@@ -271,8 +362,14 @@ void UALSExperienceManagerComponent::OnGameFeaturePluginLoadComplete(const UE::G
 	// decrement the number of plugins that are loading
 	NumGameFeaturePluginsLoading--;
 
-	if (NumGameFeaturePluginsLoading == 0)
+	// While the experience's bundles are still streaming, OnExperienceLoadComplete picks it up from here
+	if (NumGameFeaturePluginsLoading == 0 && LoadState == EALSExperienceLoadState::LoadingGameFeatures)
 	{
+		UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: Game feature plugins of %s loaded after %.2f ms (%s)"),
+			*CurrentExperience->GetPrimaryAssetId().ToString(),
+			(FPlatformTime::Seconds() - ExperienceLoadStartTime) * 1000.0,
+			*GetClientServerContextString(this));
+
 		OnExperienceFullLoadCompleted();
 	}
 }
@@ -298,40 +395,120 @@ void UALSExperienceManagerComponent::OnExperienceFullLoadCompleted()
 
 	LoadState = EALSExperienceLoadState::ExecutingActions;
 
-	// Execute the actions
-	FGameFeatureActivatingContext Context;
-
 	// Only apply to our specific world context if set
 	const FWorldContext* ExistingWorldContext = GEngine->GetWorldContextFromWorld(GetWorld());
-	if (ExistingWorldContext)
+	ActionWorldContextHandle = ExistingWorldContext ? ExistingWorldContext->ContextHandle : NAME_None;
+
+	// Every action registers before any loads, and every action loads before any activates,
+	// within a phase the actions run in the order the experience and its action sets list them
+	TArray<UGameFeatureAction*> Actions;
+	GetExperienceActions(Actions);
+	Actions.Remove(nullptr);
+
+	PendingActionSteps.Reset(Actions.Num() * 3);
+	NextActionStep = 0;
+
+	ActionPhases.Reset();
+	for (UGameFeatureAction* Action : Actions)
 	{
-		Context.SetRequiredWorldContextHandle(ExistingWorldContext->ContextHandle);
+		if (RetainedActions.Contains(Action))
+		{
+			ActionPhases.Add(Action, EActionPhase::Loading);
+		}
 	}
-
-	auto ActivateListOfActions = [&Context](const TArray<UGameFeatureAction*>& ActionList)
+	ActionTimings.Reset();
+	ActionStepsStartTime = FPlatformTime::Seconds();
+	NumActionStepFrames = 0;
+
+	//@TODO: The fact that these don't take a world are potentially problematic in client-server PIE
+	// The current behavior matches systems like gameplay tags where loading and registering apply to the entire process,
+	// but actually applying the results to actors is restricted to a specific world
+	for (const EActionPhase Phase : { EActionPhase::Registering, EActionPhase::Loading, EActionPhase::Activating })
 	{
-		for (UGameFeatureAction* Action : ActionList)
+		for (UGameFeatureAction* Action : Actions)
 		{
-			if (Action != nullptr)
+			// Actions kept from the previous map's experience are still registered and loaded
+			if (Phase != EActionPhase::Activating && RetainedActions.Contains(Action))
 			{
-				//@TODO: The fact that these don't take a world are potentially problematic in client-server PIE
-				// The current behavior matches systems like gameplay tags where loading and registering apply to the entire process,
-				// but actually applying the results to actors is restricted to a specific world
-				Action->OnGameFeatureRegistering();
-				Action->OnGameFeatureLoading();
-				Action->OnGameFeatureActivating(Context);
+				continue;
 			}
+
+			PendingActionSteps.Add({ Action, Phase });
 		}
-	};
+	}
 
-	ActivateListOfActions(CurrentExperience->Actions);
-	for (const TObjectPtr<UALSExperienceActionSet>& ActionSet : CurrentExperience->ActionSets)
+	RetainedActions.Reset();
+
+	TickActionSteps();
+}
+
+void UALSExperienceManagerComponent::TickActionSteps()
+{
+	check(LoadState == EALSExperienceLoadState::ExecutingActions);
+
+	const double BudgetSeconds = ALSConsoleVariables::ExperienceActionFrameBudgetMs / 1000.0;
+	ExecuteActionSteps(BudgetSeconds > 0.0 ? BudgetSeconds : TNumericLimits<double>::Max());
+	++NumActionStepFrames;
+
+	if (NextActionStep < PendingActionSteps.Num())
 	{
-		if (ActionSet != nullptr)
+		ActionStepTimerHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &ThisClass::TickActionSteps);
+		return;
+	}
+
+	OnAllActionsActivated();
+}
+
+void UALSExperienceManagerComponent::ExecuteActionSteps(double BudgetSeconds)
+{
+	FGameFeatureActivatingContext Context;
+	if (!ActionWorldContextHandle.IsNone())
+	{
+		Context.SetRequiredWorldContextHandle(ActionWorldContextHandle);
+	}
+
+	const double FrameStartTime = FPlatformTime::Seconds();
+
+	while (NextActionStep < PendingActionSteps.Num())
+	{
+		const FActionStep& Step = PendingActionSteps[NextActionStep++];
+		const double StepStartTime = FPlatformTime::Seconds();
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Step.Action->GetClass()->GetName());
+
+			switch (Step.Phase)
+			{
+			case EActionPhase::Registering:
+				Step.Action->OnGameFeatureRegistering();
+				break;
+			case EActionPhase::Loading:
+				Step.Action->OnGameFeatureLoading();
+				break;
+			case EActionPhase::Activating:
+				Step.Action->OnGameFeatureActivating(Context);
+				break;
+			}
+		}
+
+		ActionPhases.Add(Step.Action, Step.Phase);
+
+		const double StepEndTime = FPlatformTime::Seconds();
+		ActionTimings.FindOrAdd(Step.Action) += StepEndTime - StepStartTime;
+
+		if (StepEndTime - FrameStartTime >= BudgetSeconds)
 		{
-			ActivateListOfActions(ActionSet->Actions);
+			break;
 		}
 	}
+}
+
+void UALSExperienceManagerComponent::OnAllActionsActivated()
+{
+	PendingActionSteps.Reset();
+	NextActionStep = 0;
+
+	LogActionTimings();
 
 	LoadState = EALSExperienceLoadState::Loaded;
 
@@ -343,6 +520,33 @@ void UALSExperienceManagerComponent::OnExperienceFullLoadCompleted()
 
 	OnExperienceLoaded_LowPriority.Broadcast(CurrentExperience);
 	OnExperienceLoaded_LowPriority.Clear();
+
+	// Preload bundles and the likely next experience are streamed in without blocking this one
+	if (UALSExperienceManager* ExperienceManager = GEngine->GetEngineSubsystem<UALSExperienceManager>())
+	{
+		ExperienceManager->StartPreloading(ActionWorldContextHandle, CurrentExperience, LoadedBundles);
+	}
+}
+
+void UALSExperienceManagerComponent::LogActionTimings() const
+{
+	TArray<TPair<const UGameFeatureAction*, double>> SortedTimings;
+	double TotalSeconds = 0.0;
+	for (const TPair<const UGameFeatureAction*, double>& Timing : ActionTimings)
+	{
+		SortedTimings.Add(Timing);
+		TotalSeconds += Timing.Value;
+	}
+	SortedTimings.Sort([](const TPair<const UGameFeatureAction*, double>& A, const TPair<const UGameFeatureAction*, double>& B) { return A.Value > B.Value; });
+
+	UE_LOG(LogALSExperience, Log, TEXT("EXPERIENCE: Executed %d actions of %s in %.2f ms over %d frame(s) (%.2f ms wall time, %s)"),
+		SortedTimings.Num(), *CurrentExperience->GetPrimaryAssetId().ToString(), TotalSeconds * 1000.0, NumActionStepFrames,
+		(FPlatformTime::Seconds() - ActionStepsStartTime) * 1000.0, *GetClientServerContextString(this));
+
+	for (const TPair<const UGameFeatureAction*, double>& Timing : SortedTimings)
+	{
+		UE_LOG(LogALSExperience, Verbose, TEXT("  %.2f ms %s"), Timing.Value * 1000.0, *GetPathNameSafe(Timing.Key));
+	}
 }
 
 void UALSExperienceManagerComponent::OnActionDeactivationCompleted()
@@ -360,21 +564,64 @@ void UALSExperienceManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetime
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ThisClass, CurrentExperience);
+	DOREPLIFETIME(ThisClass, CurrentExperienceId);
 }
 
 void UALSExperienceManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
-	// deactivate any features this experience loaded
-	//@TODO: This should be handled FILO as well
-	for (const FString& PluginURL : GameFeaturePluginURLs)
+	if (LoadState == EALSExperienceLoadState::LoadingDefinition)
 	{
-		if (UALSExperienceManager::RequestToDeactivatePlugin(PluginURL))
+		LoadState = EALSExperienceLoadState::Unloaded;
+	}
+
+	// Drop the remaining action steps, only the phases the actions went through so far are torn down below
+	if (LoadState == EALSExperienceLoadState::ExecutingActions)
+	{
+		GetWorld()->GetTimerManager().ClearTimer(ActionStepTimerHandle);
+		PendingActionSteps.Reset();
+		NextActionStep = 0;
+		LoadState = EALSExperienceLoadState::Loaded;
+	}
+
+	if (ExperienceDefinitionHandle.IsValid())
+	{
+		if (ExperienceDefinitionHandle->HasLoadCompleted())
+		{
+			ExperienceDefinitionHandle->ReleaseHandle();
+		}
+		else
 		{
-			UGameFeaturesSubsystem::Get().DeactivateGameFeaturePlugin(PluginURL);
+			ExperienceDefinitionHandle->CancelHandle();
 		}
+		ExperienceDefinitionHandle.Reset();
+	}
+
+	// When travelling, hand plugins, registered actions and bundles over to the experience manager,
+	// the next map's experience decides what of it is still needed
+	UALSExperienceManager* ExperienceManager = GEngine->GetEngineSubsystem<UALSExperienceManager>();
+	const bool bDifferentialTransition = ExperienceManager && (EndPlayReason == EEndPlayReason::LevelTransition) && ALSConsoleVariables::bDifferentialExperienceTransitions;
+	FALSExperienceTransitionState OutgoingState;
+
+	if (bDifferentialTransition)
+	{
+		OutgoingState.GameFeaturePluginURLs = MoveTemp(ActivatedPluginURLs);
+		OutgoingState.BundleAssets = LoadedBundleAssets;
+		OutgoingState.Bundles = LoadedBundles;
+	}
+	else
+	{
+		// deactivate any features this experience loaded
+		//@TODO: This should be handled FILO as well
+		for (const FString& PluginURL : ActivatedPluginURLs)
+		{
+			if (UALSExperienceManager::RequestToDeactivatePlugin(PluginURL))
+			{
+				UGameFeaturesSubsystem::Get().DeactivateGameFeaturePlugin(PluginURL);
+			}
+		}
+		ActivatedPluginURLs.Reset();
 	}
 
 	//@TODO: Ensure proper handling of a partially-loaded state too
@@ -395,13 +642,29 @@ void UALSExperienceManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayR
 			Context.SetRequiredWorldContextHandle(ExistingWorldContext->ContextHandle);
 		}
 
-		auto DeactivateListOfActions = [&Context](const TArray<UGameFeatureAction*>& ActionList)
+		auto DeactivateListOfActions = [this, &Context, bDifferentialTransition, &OutgoingState](const TArray<UGameFeatureAction*>& ActionList)
 		{
 			for (UGameFeatureAction* Action : ActionList)
 			{
-				if (Action)
+				// Actions without a phase never registered, e.g. when play ended while the actions were still executing
+				EActionPhase Phase;
+				if (Action == nullptr || !ActionPhases.RemoveAndCopyValue(Action, Phase))
+				{
+					continue;
+				}
+
+				if (Phase == EActionPhase::Activating)
 				{
 					Action->OnGameFeatureDeactivating(Context);
+				}
+
+				// Registration is process wide, keep it in case the next experience uses the action too
+				if (bDifferentialTransition)
+				{
+					OutgoingState.RegisteredActions.Add(Action);
+				}
+				else
+				{
 					Action->OnGameFeatureUnregistering();
 				}
 			}
@@ -428,6 +691,12 @@ void UALSExperienceManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayR
 			OnAllActionsDeactivated();
 		}
 	}
+
+	if (bDifferentialTransition)
+	{
+		const FWorldContext* WorldContext = GEngine->GetWorldContextFromWorld(GetWorld());
+		ExperienceManager->StashOutgoingExperience(WorldContext ? WorldContext->ContextHandle : NAME_None, MoveTemp(OutgoingState));
+	}
 }
 
 bool UALSExperienceManagerComponent::ShouldShowLoadingScreen(FString& OutReason) const
@@ -448,6 +717,7 @@ void UALSExperienceManagerComponent::OnAllActionsDeactivated()
 	//@TODO: We actually only deactivated and didn't fully unload...
 	LoadState = EALSExperienceLoadState::Unloaded;
 	CurrentExperience = nullptr;
+	CurrentExperienceId = FPrimaryAssetId();
 	//@TODO:	GEngine->ForceGarbageCollection(true);
 }
 
@@ -4,6 +4,7 @@
 #include "GameModes/ALSGameMode.h"
 
 #include "Character/ALSCharacter.h"
+#include "Character/ALSCharacterPool.h"
 #include "Character/ALSPawnData.h"
 #include "Character/ALSPawnExtensionComponent.h"
 #include "Character/ALSPlayerController.h"
@@ -158,6 +159,16 @@ void AALSGameMode::OnMatchAssignmentGiven(FPrimaryAssetId ExperienceId, const FS
 
 void AALSGameMode::OnExperienceLoaded(const UALSExperienceDefinition* CurrentExperience)
 {
+	// Pre-warm the experience's pawns so respawns don't pay for constructing them
+	if (UALSCharacterPool* CharacterPool = UALSCharacterPool::Get(this))
+	{
+		const UALSPawnData* PawnData = CurrentExperience->DefaultPawnData ? CurrentExperience->DefaultPawnData.Get() : UALSAssetManager::Get().GetDefaultPawnData();
+		if (PawnData && PawnData->PawnClass && PawnData->PawnClass->IsChildOf<AALSBaseCharacter>())
+		{
+			CharacterPool->PrewarmCharacters(PawnData->PawnClass.Get());
+		}
+	}
+
 	// Spawn any players that are already attached
 	//@TODO: Here we're handling only *player* controllers, but in GetDefaultPawnClassForController_Implementation we skipped all controllers
 	// GetDefaultPawnClassForController_Implementation might only be getting called for players anyways
@@ -198,6 +209,11 @@ UClass* AALSGameMode::GetDefaultPawnClassForController_Implementation(AControlle
 
 APawn* AALSGameMode::SpawnDefaultPawnAtTransform_Implementation(AController* NewPlayer, const FTransform& SpawnTransform)
 {
+	if (APawn* PooledPawn = AcquirePooledPawn(NewPlayer, SpawnTransform))
+	{
+		return PooledPawn;
+	}
+
 	FActorSpawnParameters SpawnInfo;
 	SpawnInfo.Instigator = GetInstigator();
 	SpawnInfo.ObjectFlags |= RF_Transient;	// Never save the default player pawns into a map.
@@ -236,6 +252,36 @@ APawn* AALSGameMode::SpawnDefaultPawnAtTransform_Implementation(AController* New
 	return nullptr;
 }
 
+APawn* AALSGameMode::AcquirePooledPawn(AController* NewPlayer, const FTransform& SpawnTransform)
+{
+	UALSCharacterPool* CharacterPool = UALSCharacterPool::Get(this);
+	UClass* PawnClass = GetDefaultPawnClassForController(NewPlayer);
+	if (!CharacterPool || !PawnClass || !PawnClass->IsChildOf<AALSBaseCharacter>())
+	{
+		return nullptr;
+	}
+
+	AALSBaseCharacter* PooledCharacter = CharacterPool->AcquireCharacter(PawnClass, SpawnTransform);
+	if (!PooledCharacter)
+	{
+		return nullptr;
+	}
+
+	if (UALSPawnExtensionComponent* PawnExtComp = UALSPawnExtensionComponent::FindPawnExtensionComponent(PooledCharacter))
+	{
+		if (const UALSPawnData* PawnData = GetPawnDataForController(NewPlayer))
+		{
+			PawnExtComp->SetPawnData(PawnData);
+		}
+		else
+		{
+			UE_LOG(LogALS, Error, TEXT("Game mode was unable to set PawnData on the pooled pawn [%s]."), *GetNameSafe(PooledCharacter));
+		}
+	}
+
+	return PooledCharacter;
+}
+
 bool AALSGameMode::ShouldSpawnAtStartSpot(AController* Player)
 {
 	// We never want to use the start spot, always use the spawn management component.
@@ -324,7 +370,16 @@ void AALSGameMode::RequestPlayerRestartNextFrame(AController* Controller, bool b
 {
 	if (bForceReset && (Controller != nullptr))
 	{
+		// The reset abandons the possessed pawn, hand it back to the pool instead of leaving it behind
+		AALSBaseCharacter* AbandonedCharacter = Cast<AALSBaseCharacter>(Controller->GetPawn());
+
 		Controller->Reset();
+
+		UALSCharacterPool* CharacterPool = UALSCharacterPool::Get(this);
+		if (CharacterPool && AbandonedCharacter)
+		{
+			CharacterPool->ReleaseCharacter(AbandonedCharacter);
+		}
 	}
 
 	if (APlayerController* PC = Cast<APlayerController>(Controller))
@@ -9,14 +9,53 @@ UALSInputConfig::UALSInputConfig(const FObjectInitializer& ObjectInitializer)
 {
 }
 
-const UInputAction* UALSInputConfig::FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
+void UALSInputConfig::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildInputActionMaps();
+}
+
+#if WITH_EDITOR
+void UALSInputConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	bInputActionMapsBuilt = false;
+}
+#endif
+
+void UALSInputConfig::RebuildInputActionMaps() const
 {
-	for (const FALSInputAction& Action : NativeInputActions)
+	auto BuildMap = [](const TArray<FALSInputAction>& InputActions, TMap<FGameplayTag, const UInputAction*>& OutMap)
 	{
-		if (Action.InputAction && (Action.InputTag == InputTag))
+		OutMap.Reset();
+		OutMap.Reserve(InputActions.Num());
+		for (const FALSInputAction& Action : InputActions)
 		{
-			return Action.InputAction;
+			if (Action.InputAction && !OutMap.Contains(Action.InputTag))
+			{
+				OutMap.Add(Action.InputTag, Action.InputAction);
+			}
 		}
+	};
+
+	BuildMap(NativeInputActions, NativeInputActionMap);
+	BuildMap(AbilityInputActions, AbilityInputActionMap);
+	bInputActionMapsBuilt = true;
+}
+
+const UInputAction* UALSInputConfig::FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
+{
+	// Configs created at runtime never went through PostLoad
+	if (!bInputActionMapsBuilt)
+	{
+		RebuildInputActionMaps();
+	}
+
+	if (const UInputAction* const* InputAction = NativeInputActionMap.Find(InputTag))
+	{
+		return *InputAction;
 	}
 
 	if (bLogNotFound)
@@ -29,12 +68,14 @@ const UInputAction* UALSInputConfig::FindNativeInputActionForTag(const FGameplay
 
 const UInputAction* UALSInputConfig::FindAbilityInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
 {
-	for (const FALSInputAction& Action : AbilityInputActions)
+	if (!bInputActionMapsBuilt)
 	{
-		if (Action.InputAction && (Action.InputTag == InputTag))
-		{
-			return Action.InputAction;
-		}
+		RebuildInputActionMaps();
+	}
+
+	if (const UInputAction* const* InputAction = AbilityInputActionMap.Find(InputTag))
+	{
+		return *InputAction;
 	}
 
 	if (bLogNotFound)
@@ -43,4 +84,4 @@ const UInputAction* UALSInputConfig::FindAbilityInputActionForTag(const FGamepla
 	}
 
 	return nullptr;
-}
\ No newline at end of file
+}
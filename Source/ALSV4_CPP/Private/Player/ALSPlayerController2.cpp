@@ -12,6 +12,7 @@
 #include "AbilitySystemGlobals.h"
 #include "CommonInputSubsystem.h"
 #include "Player/ALSLocalPlayer.h"
+#include "Camera/ALSHiddenComponentsProvider.h"
 
 AALSPlayerController2::AALSPlayerController2(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -205,44 +206,30 @@ void AALSPlayerController2::UpdateHiddenComponents(const FVector& ViewLocation,
 		AActor* const ViewTargetPawn = PlayerCameraManager ? Cast<AActor>(PlayerCameraManager->GetViewTarget()) : nullptr;
 		if (ViewTargetPawn)
 		{
-			// internal helper func to hide all the components
-			auto AddToHiddenComponents = [&OutHiddenComponents](const TInlineComponentArray<UPrimitiveComponent*>& InComponents)
+			//TODO Hiding isn't awesome, sometimes you want the effect of a fade out over a proximity, needs to bubble up to designers.
+
+			// View targets may provide their own hide set (e.g. to hide a weapon too), others hide their components and attached children
+			const IALSHiddenComponentsProvider* Provider = Cast<IALSHiddenComponentsProvider>(ViewTargetPawn);
+			const uint32 Revision = Provider ? Provider->GetHiddenComponentsRevision() : IALSHiddenComponentsProvider::ComputeAttachmentRevision(*ViewTargetPawn);
+
+			// Gather again only when the view target or its components changed, otherwise it's a set copy
+			if (HiddenComponentsViewTarget != ViewTargetPawn || HiddenComponentsRevision != Revision)
 			{
-				// add every component and all attached children
-				for (UPrimitiveComponent* Comp : InComponents)
+				CachedHiddenComponents.Reset();
+				if (Provider)
 				{
-					if (Comp->IsRegistered())
-					{
-						OutHiddenComponents.Add(Comp->ComponentId);
-
-						for (USceneComponent* AttachedChild : Comp->GetAttachChildren())
-						{
-							static FName NAME_NoParentAutoHide(TEXT("NoParentAutoHide"));
-							UPrimitiveComponent* AttachChildPC = Cast<UPrimitiveComponent>(AttachedChild);
-							if (AttachChildPC && AttachChildPC->IsRegistered() && !AttachChildPC->ComponentTags.Contains(NAME_NoParentAutoHide))
-							{
-								OutHiddenComponents.Add(AttachChildPC->ComponentId);
-							}
-						}
-					}
+					Provider->GatherHiddenComponents(CachedHiddenComponents);
+				}
+				else
+				{
+					IALSHiddenComponentsProvider::GatherAttachedPrimitives(*ViewTargetPawn, CachedHiddenComponents);
 				}
-			};
 
-			//TODO Solve with an interface.  Gather hidden components or something.
-			//TODO Hiding isn't awesome, sometimes you want the effect of a fade out over a proximity, needs to bubble up to designers.
+				HiddenComponentsViewTarget = ViewTargetPawn;
+				HiddenComponentsRevision = Revision;
+			}
 
-			// hide pawn's components
-			TInlineComponentArray<UPrimitiveComponent*> PawnComponents;
-			ViewTargetPawn->GetComponents(PawnComponents);
-			AddToHiddenComponents(PawnComponents);
-
-			//// hide weapon too
-			//if (ViewTargetPawn->CurrentWeapon)
-			//{
-			//	TInlineComponentArray<UPrimitiveComponent*> WeaponComponents;
-			//	ViewTargetPawn->CurrentWeapon->GetComponents(WeaponComponents);
-			//	AddToHiddenComponents(WeaponComponents);
-			//}
+			OutHiddenComponents.Append(CachedHiddenComponents);
 		}
 
 		// we consumed it, reset for next frame
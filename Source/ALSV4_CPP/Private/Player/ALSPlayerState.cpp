@@ -219,6 +219,16 @@ void AALSPlayerState::RemoveStatTagStack(FGameplayTag Tag, int32 StackCount)
 	StatTags.RemoveStack(Tag, StackCount);
 }
 
+void AALSPlayerState::AddStatTagStacks(const TMap<FGameplayTag, int32>& TagStackCounts)
+{
+	StatTags.AddStacks(TagStackCounts);
+}
+
+void AALSPlayerState::RemoveStatTagStacks(const TMap<FGameplayTag, int32>& TagStackCounts)
+{
+	StatTags.RemoveStacks(TagStackCounts);
+}
+
 int32 AALSPlayerState::GetStatTagStackCount(FGameplayTag Tag) const
 {
 	return StatTags.GetStackCount(Tag);
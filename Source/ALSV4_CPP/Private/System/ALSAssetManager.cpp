@@ -11,6 +11,9 @@
 // #include "AbilitySystem/ALSGameplayCueManager.h"
 #include "SWarningOrErrorBox.h"
 #include "Misc/ScopedSlowTask.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "System/ALSStartupTelemetry.h"
+#include "System/ALSSyncLoadDetector.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ALSAssetManager)
 
@@ -62,6 +65,10 @@ UObject* UALSAssetManager::SynchronousLoadAsset(const FSoftObjectPath& AssetPath
 			LogTimePtr = MakeUnique<FScopeLogTime>(*FString::Printf(TEXT("Synchronously loaded asset [%s]"), *AssetPath.ToString()), nullptr, FScopeLogTime::ScopeLog_Seconds);
 		}
 
+#if ALS_WITH_SYNC_LOAD_DETECTOR
+		FALSSyncLoadDetector::FScopedLoad ScopedSyncLoad(AssetPath);
+#endif
+
 		if (UAssetManager::IsValid())
 		{
 			return UAssetManager::GetStreamableManager().LoadSynchronous(AssetPath, false);
@@ -111,12 +118,22 @@ void UALSAssetManager::StartInitialLoading()
 	// This does all of the scanning, need to do this now even if loads are deferred
 	Super::StartInitialLoading();
 
+#if ALS_WITH_SYNC_LOAD_DETECTOR
+	if (FParse::Param(FCommandLine::Get(), TEXT("ALSDetectSyncLoads")))
+	{
+		FALSSyncLoadDetector::Get().SetEnabled(true);
+	}
+#endif
+
+	// Jobs start in order, so the game data request goes first and streams in while the ability system initializes
+	const int32 LoadGameDataJob = STARTUP_JOB_WEIGHTED(StartLoadingGameData(LoadHandle), 24.f);
+
 	STARTUP_JOB(InitializeAbilitySystem());
 	//STARTUP_JOB(InitializeGameplayCueManager());
 
 	{
-		// Load base game data asset
-		STARTUP_JOB_WEIGHTED(GetGameData(), 25.f);
+		const int32 GetGameDataJob = STARTUP_JOB(GetGameData());
+		StartupJobs[GetGameDataJob].Prerequisites.Add(LoadGameDataJob);
 	}
 
 	// Run all the queued up startup jobs
@@ -143,6 +160,15 @@ void UALSAssetManager::InitializeGameplayCueManager()
 }
 
 
+void UALSAssetManager::StartLoadingGameData(TSharedPtr<FStreamableHandle>& OutLoadHandle)
+{
+	// The editor loads game data synchronously on demand, see LoadGameDataOfClass
+	if (!GIsEditor && !ALSGameDataPath.IsNull())
+	{
+		OutLoadHandle = LoadPrimaryAssetsWithType(UALSGameData::StaticClass()->GetFName());
+	}
+}
+
 const UALSGameData& UALSAssetManager::GetGameData()
 {
 	return GetOrLoadTypedGameData<UALSGameData>(ALSGameDataPath);
@@ -169,6 +195,10 @@ UPrimaryDataAsset* UALSAssetManager::LoadGameDataOfClass(TSubclassOf<UPrimaryDat
 		UE_LOG(LogALS, Log, TEXT("Loading GameData: %s ..."), *DataClassPath.ToString());
 		SCOPE_LOG_TIME_IN_SECONDS(TEXT("    ... GameData loaded!"), nullptr);
 
+#if ALS_WITH_SYNC_LOAD_DETECTOR
+		FALSSyncLoadDetector::FScopedLoad ScopedSyncLoad(DataClassPath.ToSoftObjectPath());
+#endif
+
 		// This can be called recursively in the editor because it is called on demand from PostLoad so force a sync load for primary asset and async load the rest in that case
 		if (GIsEditor)
 		{
@@ -207,53 +237,144 @@ void UALSAssetManager::DoAllStartupJobs()
 	SCOPED_BOOT_TIMING("UALSAssetManager::DoAllStartupJobs");
 	const double AllStartupJobsStartTime = FPlatformTime::Seconds();
 
-	if (IsRunningDedicatedServer())
+	// No need for periodic progress updates on dedicated servers
+	const bool bReportProgress = !IsRunningDedicatedServer();
+
+	FALSStartupTelemetry Telemetry;
+
+	if (StartupJobs.Num() == 0)
 	{
-		// No need for periodic progress updates, just run the jobs
-		for (const FALSAssetManagerStartupJob& StartupJob : StartupJobs)
+		if (bReportProgress)
 		{
-			StartupJob.DoJob();
+			UpdateInitialGameContentLoadPercent(1.0f);
 		}
+		return;
 	}
-	else
+
+	enum class EJobState : uint8
+	{
+		Pending,
+		Running,
+		Finished
+	};
+
+	const int32 NumJobs = StartupJobs.Num();
+	TArray<EJobState> JobStates;
+	JobStates.Init(EJobState::Pending, NumJobs);
+	TArray<TSharedPtr<FStreamableHandle>> JobHandles;
+	JobHandles.SetNum(NumJobs);
+	TArray<float> JobProgress;
+	JobProgress.SetNumZeroed(NumJobs);
+
+	float TotalJobValue = 0.0f;
+	for (const FALSAssetManagerStartupJob& StartupJob : StartupJobs)
 	{
-		if (StartupJobs.Num() > 0)
+		TotalJobValue += StartupJob.JobWeight;
+	}
+
+	// Several jobs can be in flight, so the overall percent is the weighted sum of every job's progress
+	auto ReportProgress = [this, &JobProgress, TotalJobValue]()
+	{
+		float AccumulatedJobValue = 0.0f;
+		for (int32 JobIndex = 0; JobIndex < StartupJobs.Num(); ++JobIndex)
 		{
-			float TotalJobValue = 0.0f;
-			for (const FALSAssetManagerStartupJob& StartupJob : StartupJobs)
+			AccumulatedJobValue += JobProgress[JobIndex] * StartupJobs[JobIndex].JobWeight;
+		}
+
+		UpdateInitialGameContentLoadPercent(TotalJobValue > 0.0f ? AccumulatedJobValue / TotalJobValue : 1.0f);
+	};
+
+	if (bReportProgress)
+	{
+		for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+		{
+			StartupJobs[JobIndex].SubstepProgressDelegate.BindLambda([&JobProgress, &ReportProgress, JobIndex](float NewProgress)
+				{
+					JobProgress[JobIndex] = FMath::Clamp(NewProgress, 0.0f, 1.0f);
+					ReportProgress();
+				});
+		}
+	}
+
+	auto ArePrerequisitesFinished = [this, &JobStates](int32 JobIndex)
+	{
+		for (const int32 Prerequisite : StartupJobs[JobIndex].Prerequisites)
+		{
+			if (JobStates.IsValidIndex(Prerequisite) && JobStates[Prerequisite] != EJobState::Finished)
 			{
-				TotalJobValue += StartupJob.JobWeight;
+				return false;
 			}
+		}
+		return true;
+	};
 
-			float AccumulatedJobValue = 0.0f;
-			for (FALSAssetManagerStartupJob& StartupJob : StartupJobs)
-			{
-				const float JobValue = StartupJob.JobWeight;
-				StartupJob.SubstepProgressDelegate.BindLambda([This = this, AccumulatedJobValue, JobValue, TotalJobValue](float NewProgress)
-					{
-						const float SubstepAdjustment = FMath::Clamp(NewProgress, 0.0f, 1.0f) * JobValue;
-						const float OverallPercentWithSubstep = (AccumulatedJobValue + SubstepAdjustment) / TotalJobValue;
+	bool bIgnorePrerequisites = false;
+	int32 NumFinishedJobs = 0;
+	while (NumFinishedJobs < NumJobs)
+	{
+		bool bMadeProgress = false;
 
-						This->UpdateInitialGameContentLoadPercent(OverallPercentWithSubstep);
-					});
+		// Start every job that is ready. Synchronous jobs complete right here, loads keep streaming in the background.
+		for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+		{
+			if (JobStates[JobIndex] == EJobState::Pending && (bIgnorePrerequisites || ArePrerequisitesFinished(JobIndex)))
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*StartupJobs[JobIndex].JobName);
+				Telemetry.BeginJob(JobIndex, StartupJobs[JobIndex].JobName);
+				JobHandles[JobIndex] = StartupJobs[JobIndex].StartJob();
+				JobStates[JobIndex] = EJobState::Running;
+				bMadeProgress = true;
+			}
+		}
 
-				StartupJob.DoJob();
+		// Retire jobs whose loads have completed
+		for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+		{
+			const TSharedPtr<FStreamableHandle>& Handle = JobHandles[JobIndex];
+			if (JobStates[JobIndex] == EJobState::Running && (!Handle.IsValid() || Handle->HasLoadCompleted() || Handle->WasCanceled()))
+			{
+				StartupJobs[JobIndex].FinishJob(Handle);
+				Telemetry.EndJob(JobIndex);
+				StartupJobs[JobIndex].SubstepProgressDelegate.Unbind();
+				JobHandles[JobIndex].Reset();
+				JobStates[JobIndex] = EJobState::Finished;
+				JobProgress[JobIndex] = 1.0f;
+				++NumFinishedJobs;
+				bMadeProgress = true;
+
+				if (bReportProgress)
+				{
+					ReportProgress();
+				}
+			}
+		}
 
-				StartupJob.SubstepProgressDelegate.Unbind();
+		if (bMadeProgress)
+		{
+			continue;
+		}
 
-				AccumulatedJobValue += JobValue;
+		// Nothing to start, wait on one of the in-flight loads. The others keep streaming while we wait.
+		const TSharedPtr<FStreamableHandle>* InFlightHandle = JobHandles.FindByPredicate([](const TSharedPtr<FStreamableHandle>& Handle)
+		{
+			return Handle.IsValid();
+		});
 
-				UpdateInitialGameContentLoadPercent(AccumulatedJobValue / TotalJobValue);
-			}
+		if (InFlightHandle)
+		{
+			(*InFlightHandle)->WaitUntilComplete(1.0f / 60.0f, false);
 		}
 		else
 		{
-			UpdateInitialGameContentLoadPercent(1.0f);
+			UE_LOG(LogALS, Error, TEXT("Startup jobs have circular prerequisites, running the remaining jobs in declaration order"));
+			bIgnorePrerequisites = true;
 		}
 	}
 
 	StartupJobs.Empty();
 
+	Telemetry.Finish();
+
 	UE_LOG(LogALS, Display, TEXT("All startup jobs took %.2f seconds to complete"), FPlatformTime::Seconds() - AllStartupJobsStartTime);
 }
 
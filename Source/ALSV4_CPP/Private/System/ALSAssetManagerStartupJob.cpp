@@ -10,7 +10,21 @@
 
 TSharedPtr<FStreamableHandle> FALSAssetManagerStartupJob::DoJob() const
 {
-	const double JobStartTime = FPlatformTime::Seconds();
+	TSharedPtr<FStreamableHandle> Handle = StartJob();
+
+	if (Handle.IsValid())
+	{
+		Handle->WaitUntilComplete(0.0f, false);
+	}
+
+	FinishJob(Handle);
+
+	return Handle;
+}
+
+TSharedPtr<FStreamableHandle> FALSAssetManagerStartupJob::StartJob() const
+{
+	StartTime = FPlatformTime::Seconds();
 
 	TSharedPtr<FStreamableHandle> Handle;
 	UE_LOG(LogALS, Display, TEXT("Startup job \"%s\" starting"), *JobName);
@@ -19,11 +33,17 @@ TSharedPtr<FStreamableHandle> FALSAssetManagerStartupJob::DoJob() const
 	if (Handle.IsValid())
 	{
 		Handle->BindUpdateDelegate(FStreamableUpdateDelegate::CreateRaw(this, &FALSAssetManagerStartupJob::UpdateSubstepProgressFromStreamable));
-		Handle->WaitUntilComplete(0.0f, false);
-		Handle->BindUpdateDelegate(FStreamableUpdateDelegate());
 	}
 
-	UE_LOG(LogALS, Display, TEXT("Startup job \"%s\" took %.2f seconds to complete"), *JobName, FPlatformTime::Seconds() - JobStartTime);
-
 	return Handle;
 }
+
+void FALSAssetManagerStartupJob::FinishJob(const TSharedPtr<FStreamableHandle>& Handle) const
+{
+	if (Handle.IsValid())
+	{
+		Handle->BindUpdateDelegate(FStreamableUpdateDelegate());
+	}
+
+	UE_LOG(LogALS, Display, TEXT("Startup job \"%s\" took %.2f seconds to complete"), *JobName, FPlatformTime::Seconds() - StartTime);
+}
@@ -0,0 +1,100 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#include "System/ALSCompareStartupTimingsCommandlet.h"
+
+#include "ALSLogChannels.h"
+#include "System/ALSStartupTelemetry.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ALSCompareStartupTimingsCommandlet)
+
+UALSCompareStartupTimingsCommandlet::UALSCompareStartupTimingsCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UALSCompareStartupTimingsCommandlet::Main(const FString& Params)
+{
+	FString BaselinePath;
+	FString CurrentPath;
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+	FParse::Value(*Params, TEXT("Current="), CurrentPath);
+
+	FString Role = TEXT("Client");
+	FParse::Value(*Params, TEXT("Role="), Role);
+
+	float ThresholdPercent = 10.0f;
+	float MinDeltaSeconds = 0.05f;
+	FParse::Value(*Params, TEXT("Threshold="), ThresholdPercent);
+	FParse::Value(*Params, TEXT("MinDelta="), MinDeltaSeconds);
+
+	if (BaselinePath.IsEmpty() || CurrentPath.IsEmpty())
+	{
+		const TArray<FString> Reports = FALSStartupTelemetry::FindReports(Role);
+		if (Reports.Num() < 2)
+		{
+			UE_LOG(LogALS, Error, TEXT("Need two %s startup reports to compare, found %d in %s"), *Role, Reports.Num(), *FALSStartupTelemetry::GetReportDirectory());
+			return 2;
+		}
+
+		if (CurrentPath.IsEmpty())
+		{
+			CurrentPath = Reports.Last();
+		}
+		if (BaselinePath.IsEmpty())
+		{
+			BaselinePath = Reports.Last(1);
+		}
+	}
+
+	TArray<FALSStartupJobRecord> BaselineRecords;
+	TArray<FALSStartupJobRecord> CurrentRecords;
+	if (!FALSStartupTelemetry::ReadReport(BaselinePath, BaselineRecords) || !FALSStartupTelemetry::ReadReport(CurrentPath, CurrentRecords))
+	{
+		UE_LOG(LogALS, Error, TEXT("Failed to read startup reports %s and %s"), *BaselinePath, *CurrentPath);
+		return 2;
+	}
+
+	UE_LOG(LogALS, Display, TEXT("Comparing startup report %s against baseline %s"), *CurrentPath, *BaselinePath);
+
+	int32 NumRegressions = 0;
+	for (const FALSStartupJobRecord& Current : CurrentRecords)
+	{
+		const FALSStartupJobRecord* Baseline = BaselineRecords.FindByPredicate([&Current](const FALSStartupJobRecord& Record)
+		{
+			return Record.JobName == Current.JobName;
+		});
+
+		if (!Baseline)
+		{
+			UE_LOG(LogALS, Display, TEXT("  %-40s %8.3fs (new job)"), *Current.JobName, Current.WallSeconds);
+			continue;
+		}
+
+		const double DeltaSeconds = Current.WallSeconds - Baseline->WallSeconds;
+		const double DeltaPercent = Baseline->WallSeconds > 0.0 ? DeltaSeconds / Baseline->WallSeconds * 100.0 : 0.0;
+		// Any measurable time is an unbounded increase over a job that took none in the baseline
+		const bool bSlower = DeltaSeconds > MinDeltaSeconds && (Baseline->WallSeconds <= 0.0 || DeltaPercent > ThresholdPercent);
+		const bool bMoreSyncLoads = Current.SyncLoadCount > Baseline->SyncLoadCount;
+
+		if (bSlower || bMoreSyncLoads)
+		{
+			++NumRegressions;
+			UE_LOG(LogALS, Error, TEXT("  %-40s %8.3fs -> %8.3fs (%+.1f%%), sync loads %d -> %d, packages %d -> %d  REGRESSION"),
+				*Current.JobName, Baseline->WallSeconds, Current.WallSeconds, DeltaPercent, Baseline->SyncLoadCount,
+				Current.SyncLoadCount, Baseline->PackageCount, Current.PackageCount);
+		}
+		else
+		{
+			UE_LOG(LogALS, Display, TEXT("  %-40s %8.3fs -> %8.3fs (%+.1f%%), sync loads %d -> %d, packages %d -> %d"),
+				*Current.JobName, Baseline->WallSeconds, Current.WallSeconds, DeltaPercent, Baseline->SyncLoadCount,
+				Current.SyncLoadCount, Baseline->PackageCount, Current.PackageCount);
+		}
+	}
+
+	UE_LOG(LogALS, Display, TEXT("%d startup regression(s) found"), NumRegressions);
+	return NumRegressions > 0 ? 1 : 0;
+}
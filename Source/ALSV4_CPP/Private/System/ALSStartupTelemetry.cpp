@@ -0,0 +1,219 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#include "System/ALSStartupTelemetry.h"
+
+#include "ALSLogChannels.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+
+const TCHAR* FALSStartupTelemetry::TotalRecordName = TEXT("Total");
+
+FALSStartupTelemetry::FALSStartupTelemetry()
+{
+	SyncLoadHandle = FCoreDelegates::OnSyncLoadPackage.AddRaw(this, &FALSStartupTelemetry::HandleSyncLoadPackage);
+	FirstSample = TakeSample();
+}
+
+FALSStartupTelemetry::~FALSStartupTelemetry()
+{
+	FCoreDelegates::OnSyncLoadPackage.Remove(SyncLoadHandle);
+}
+
+void FALSStartupTelemetry::HandleSyncLoadPackage(const FString& PackageName)
+{
+	++NumSyncLoads;
+}
+
+FALSStartupTelemetry::FSample FALSStartupTelemetry::TakeSample() const
+{
+	FSample Sample;
+	Sample.Time = FPlatformTime::Seconds();
+	Sample.SyncLoads = NumSyncLoads;
+
+#if !UE_BUILD_SHIPPING
+	// Only sampled twice per job, walking the packages is cheap compared to the loads themselves
+	for (TObjectIterator<UPackage> It; It; ++It)
+	{
+		++Sample.Packages;
+		Sample.Bytes += It->GetFileSize();
+	}
+#endif
+
+	return Sample;
+}
+
+void FALSStartupTelemetry::BeginJob(int32 JobIndex, const FString& JobName)
+{
+	TRACE_BOOKMARK(TEXT("ALS startup job begin: %s"), *JobName);
+
+	const int32 RecordIndex = Records.AddDefaulted();
+	Records[RecordIndex].JobName = JobName;
+	JobStartSamples.Add(TakeSample());
+	JobIndexToRecord.Add(JobIndex, RecordIndex);
+}
+
+void FALSStartupTelemetry::EndJob(int32 JobIndex)
+{
+	const int32* RecordIndex = JobIndexToRecord.Find(JobIndex);
+	if (!RecordIndex)
+	{
+		return;
+	}
+
+	const FSample EndSample = TakeSample();
+	const FSample& StartSample = JobStartSamples[*RecordIndex];
+
+	FALSStartupJobRecord& Record = Records[*RecordIndex];
+	Record.StartSeconds = StartSample.Time - FirstSample.Time;
+	Record.WallSeconds = EndSample.Time - StartSample.Time;
+	Record.BytesLoaded = EndSample.Bytes - StartSample.Bytes;
+	Record.SyncLoadCount = EndSample.SyncLoads - StartSample.SyncLoads;
+	Record.PackageCount = EndSample.Packages - StartSample.Packages;
+
+	TRACE_BOOKMARK(TEXT("ALS startup job end: %s"), *Record.JobName);
+}
+
+void FALSStartupTelemetry::Finish()
+{
+	const FSample EndSample = TakeSample();
+
+	FALSStartupJobRecord& Total = Records.AddDefaulted_GetRef();
+	Total.JobName = TotalRecordName;
+	Total.WallSeconds = EndSample.Time - FirstSample.Time;
+	Total.BytesLoaded = EndSample.Bytes - FirstSample.Bytes;
+	Total.SyncLoadCount = EndSample.SyncLoads - FirstSample.SyncLoads;
+	Total.PackageCount = EndSample.Packages - FirstSample.Packages;
+
+#if !UE_BUILD_SHIPPING
+	// Commandlets boot through the asset manager too, their reports would be compared as game startups
+	if (!IsRunningCommandlet())
+	{
+		WriteReport();
+	}
+#endif
+}
+
+FString FALSStartupTelemetry::GetReportDirectory()
+{
+	return FPaths::ProfilingDir() / TEXT("ALSStartup");
+}
+
+const TCHAR* FALSStartupTelemetry::GetRole()
+{
+	return IsRunningDedicatedServer() ? TEXT("Server") : TEXT("Client");
+}
+
+TArray<FString> FALSStartupTelemetry::FindReports(const FString& Role)
+{
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(GetReportDirectory() / FString::Printf(TEXT("ALSStartup_%s_*.json"), *Role)), true, false);
+
+	TArray<TPair<FDateTime, FString>> Reports;
+	for (const FString& FileName : FileNames)
+	{
+		const FString FilePath = GetReportDirectory() / FileName;
+		Reports.Emplace(IFileManager::Get().GetTimeStamp(*FilePath), FilePath);
+	}
+
+	Reports.Sort([](const TPair<FDateTime, FString>& A, const TPair<FDateTime, FString>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	TArray<FString> FilePaths;
+	for (const TPair<FDateTime, FString>& Report : Reports)
+	{
+		FilePaths.Add(Report.Value);
+	}
+	return FilePaths;
+}
+
+void FALSStartupTelemetry::WriteReport() const
+{
+	const FString BaseName = GetReportDirectory() / FString::Printf(TEXT("ALSStartup_%s_%s"), GetRole(), *FDateTime::Now().ToString());
+
+	FString Csv = TEXT("JobName,StartSeconds,WallSeconds,BytesLoaded,SyncLoadCount,PackageCount\n");
+	TArray<TSharedPtr<FJsonValue>> JsonJobs;
+
+	for (const FALSStartupJobRecord& Record : Records)
+	{
+		Csv += FString::Printf(TEXT("\"%s\",%.4f,%.4f,%lld,%d,%d\n"), *Record.JobName, Record.StartSeconds,
+			Record.WallSeconds, Record.BytesLoaded, Record.SyncLoadCount, Record.PackageCount);
+
+		TSharedRef<FJsonObject> JsonJob = MakeShared<FJsonObject>();
+		JsonJob->SetStringField(TEXT("JobName"), Record.JobName);
+		JsonJob->SetNumberField(TEXT("StartSeconds"), Record.StartSeconds);
+		JsonJob->SetNumberField(TEXT("WallSeconds"), Record.WallSeconds);
+		JsonJob->SetNumberField(TEXT("BytesLoaded"), static_cast<double>(Record.BytesLoaded));
+		JsonJob->SetNumberField(TEXT("SyncLoadCount"), Record.SyncLoadCount);
+		JsonJob->SetNumberField(TEXT("PackageCount"), Record.PackageCount);
+		JsonJobs.Add(MakeShared<FJsonValueObject>(JsonJob));
+	}
+
+	TSharedRef<FJsonObject> JsonRoot = MakeShared<FJsonObject>();
+	JsonRoot->SetStringField(TEXT("Platform"), FPlatformProperties::PlatformName());
+	JsonRoot->SetBoolField(TEXT("DedicatedServer"), IsRunningDedicatedServer());
+	JsonRoot->SetArrayField(TEXT("Jobs"), JsonJobs);
+
+	FString Json;
+	FJsonSerializer::Serialize(JsonRoot, TJsonWriterFactory<>::Create(&Json));
+
+	if (FFileHelper::SaveStringToFile(Csv, *(BaseName + TEXT(".csv"))) && FFileHelper::SaveStringToFile(Json, *(BaseName + TEXT(".json"))))
+	{
+		UE_LOG(LogALS, Display, TEXT("Startup telemetry written to %s.[csv|json]"), *BaseName);
+	}
+	else
+	{
+		UE_LOG(LogALS, Warning, TEXT("Failed to write startup telemetry to %s"), *BaseName);
+	}
+}
+
+bool FALSStartupTelemetry::ReadReport(const FString& FilePath, TArray<FALSStartupJobRecord>& OutRecords)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *FilePath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonRoot;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), JsonRoot) || !JsonRoot.IsValid())
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonJobs = nullptr;
+	if (!JsonRoot->TryGetArrayField(TEXT("Jobs"), JsonJobs))
+	{
+		return false;
+	}
+
+	OutRecords.Reset(JsonJobs->Num());
+	for (const TSharedPtr<FJsonValue>& JsonValue : *JsonJobs)
+	{
+		const TSharedPtr<FJsonObject>* JsonJob = nullptr;
+		if (!JsonValue->TryGetObject(JsonJob))
+		{
+			continue;
+		}
+
+		FALSStartupJobRecord& Record = OutRecords.AddDefaulted_GetRef();
+		Record.JobName = (*JsonJob)->GetStringField(TEXT("JobName"));
+		Record.StartSeconds = (*JsonJob)->GetNumberField(TEXT("StartSeconds"));
+		Record.WallSeconds = (*JsonJob)->GetNumberField(TEXT("WallSeconds"));
+		Record.BytesLoaded = static_cast<int64>((*JsonJob)->GetNumberField(TEXT("BytesLoaded")));
+		Record.SyncLoadCount = (*JsonJob)->GetIntegerField(TEXT("SyncLoadCount"));
+		Record.PackageCount = (*JsonJob)->GetIntegerField(TEXT("PackageCount"));
+	}
+
+	return true;
+}
@@ -0,0 +1,266 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#include "System/ALSSyncLoadDetector.h"
+
+#if ALS_WITH_SYNC_LOAD_DETECTOR
+
+#include "ALSLogChannels.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformStackWalk.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CoreDelegates.h"
+
+static bool bSyncLoadDetectorEnabled = false;
+static FAutoConsoleVariableRef CVarSyncLoadsEnable(
+	TEXT("ALS.SyncLoads.Enable"),
+	bSyncLoadDetectorEnabled,
+	TEXT("Records every synchronous load on the game thread during gameplay, see ALS.SyncLoads.Dump."),
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*) { FALSSyncLoadDetector::Get().SetEnabled(bSyncLoadDetectorEnabled); }),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarSyncLoadsHitchThresholdMs(
+	TEXT("ALS.SyncLoads.HitchThresholdMs"),
+	0.0f,
+	TEXT("Exactly timed synchronous loads taking longer than this are reported as errors. 0 disables the check."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSyncLoadsMaxCount(
+	TEXT("ALS.SyncLoads.MaxCount"),
+	-1,
+	TEXT("Number of synchronous loads allowed during gameplay before they are reported as errors. -1 disables the check."),
+	ECVF_Default);
+
+static FAutoConsoleCommand CmdSyncLoadsDump(
+	TEXT("ALS.SyncLoads.Dump"),
+	TEXT("Logs every synchronous load recorded during gameplay, with durations and callstacks."),
+	FConsoleCommandDelegate::CreateLambda([]() { FALSSyncLoadDetector::Get().DumpReport(); }));
+
+static FAutoConsoleCommand CmdSyncLoadsReset(
+	TEXT("ALS.SyncLoads.Reset"),
+	TEXT("Clears the recorded synchronous loads."),
+	FConsoleCommandDelegate::CreateLambda([]() { FALSSyncLoadDetector::Get().ResetReport(); }));
+
+FALSSyncLoadDetector& FALSSyncLoadDetector::Get()
+{
+	static FALSSyncLoadDetector Detector;
+	return Detector;
+}
+
+void FALSSyncLoadDetector::SetEnabled(bool bEnabled)
+{
+	if (bEnabled == IsEnabled())
+	{
+		return;
+	}
+
+	if (bEnabled)
+	{
+		FPlatformStackWalk::InitStackWalking();
+		SyncLoadHandle = FCoreDelegates::OnSyncLoadPackage.AddRaw(this, &FALSSyncLoadDetector::HandleSyncLoadPackage);
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FALSSyncLoadDetector::HandleEndFrame);
+		PreExitHandle = FCoreDelegates::OnEnginePreExit.AddRaw(this, &FALSSyncLoadDetector::HandleEnginePreExit);
+		UE_LOG(LogALS, Display, TEXT("Synchronous load detection enabled"));
+	}
+	else
+	{
+		CloseOpenLoad(FPlatformTime::Seconds());
+		FCoreDelegates::OnSyncLoadPackage.Remove(SyncLoadHandle);
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		FCoreDelegates::OnEnginePreExit.Remove(PreExitHandle);
+		SyncLoadHandle.Reset();
+		EndFrameHandle.Reset();
+		PreExitHandle.Reset();
+	}
+}
+
+bool FALSSyncLoadDetector::ShouldTrackLoad() const
+{
+	if (!IsEnabled() || !IsInGameThread() || !GEngine)
+	{
+		return false;
+	}
+
+	// Only loads during gameplay are hitches, boot and map loads are expected to load synchronously
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		const UWorld* World = WorldContext.World();
+		if (World && World->IsGameWorld() && World->HasBegunPlay())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FALSSyncLoadDetector::CaptureCallstack(FOpenLoad& Load) const
+{
+	Load.CallstackDepth = FPlatformStackWalk::CaptureStackBackTrace(Load.Callstack, MaxCallstackDepth);
+}
+
+void FALSSyncLoadDetector::HandleSyncLoadPackage(const FString& PackageName)
+{
+	// Loads issued inside a scoped load belong to it
+	if (ScopedLoadDepth > 0)
+	{
+		++NumScopedPackageLoads;
+		return;
+	}
+
+	if (!ShouldTrackLoad())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	CloseOpenLoad(Now);
+
+	FOpenLoad& Load = OpenLoad.Emplace();
+	Load.AssetName = PackageName;
+	Load.StartTime = Now;
+	CaptureCallstack(Load);
+}
+
+void FALSSyncLoadDetector::HandleEndFrame()
+{
+	CloseOpenLoad(FPlatformTime::Seconds());
+}
+
+void FALSSyncLoadDetector::CloseOpenLoad(double EndTime)
+{
+	if (OpenLoad.IsSet())
+	{
+		AddRecord(OpenLoad.GetValue(), EndTime - OpenLoad->StartTime, false);
+		OpenLoad.Reset();
+	}
+}
+
+void FALSSyncLoadDetector::AddRecord(const FOpenLoad& Load, double Seconds, bool bExactDuration)
+{
+	const uint32 CallstackHash = FCrc::MemCrc32(Load.Callstack, Load.CallstackDepth * sizeof(uint64));
+
+	FLoadRecord& Record = Records.FindOrAdd(TPair<FString, uint32>(Load.AssetName, CallstackHash));
+	if (Record.Count == 0)
+	{
+		Record.AssetName = Load.AssetName;
+		Record.Callstack.Append(Load.Callstack, Load.CallstackDepth);
+	}
+
+	++Record.Count;
+	Record.TotalSeconds += Seconds;
+	Record.MaxSeconds = FMath::Max(Record.MaxSeconds, Seconds);
+	Record.bExactDuration &= bExactDuration;
+	++TotalLoadCount;
+
+	FString BudgetError;
+
+	// Loads timed until the next load or the end of the frame are only upper bounds, they'd flag loads that never hitched
+	const float HitchThresholdMs = CVarSyncLoadsHitchThresholdMs.GetValueOnGameThread();
+	if (bExactDuration && HitchThresholdMs > 0.0f && Seconds * 1000.0 > HitchThresholdMs)
+	{
+		BudgetError = FString::Printf(TEXT("Synchronous load of %s took %.2f ms during gameplay (threshold %.2f ms)"), *Load.AssetName, Seconds * 1000.0, HitchThresholdMs);
+	}
+
+	const int32 MaxCount = CVarSyncLoadsMaxCount.GetValueOnGameThread();
+	if (MaxCount >= 0 && TotalLoadCount == MaxCount + 1)
+	{
+		BudgetError = FString::Printf(TEXT("More than %d synchronous loads during gameplay, last one was %s"), MaxCount, *Load.AssetName);
+	}
+
+	if (!BudgetError.IsEmpty())
+	{
+		++NumBudgetViolations;
+		UE_LOG(LogALS, Error, TEXT("%s"), *BudgetError);
+
+#if WITH_AUTOMATION_TESTS
+		if (FAutomationTestBase* CurrentTest = FAutomationTestFramework::Get().GetCurrentTest())
+		{
+			CurrentTest->AddError(BudgetError);
+		}
+#endif
+	}
+}
+
+void FALSSyncLoadDetector::HandleEnginePreExit()
+{
+	CloseOpenLoad(FPlatformTime::Seconds());
+
+	if (NumBudgetViolations > 0)
+	{
+		UE_LOG(LogALS, Error, TEXT("%d synchronous load budget violation(s) during this session"), NumBudgetViolations);
+		DumpReport();
+	}
+
+	SetEnabled(false);
+}
+
+void FALSSyncLoadDetector::DumpReport() const
+{
+	TArray<const FLoadRecord*> SortedRecords;
+	for (const TPair<TPair<FString, uint32>, FLoadRecord>& Pair : Records)
+	{
+		SortedRecords.Add(&Pair.Value);
+	}
+	SortedRecords.Sort([](const FLoadRecord& A, const FLoadRecord& B) { return A.TotalSeconds > B.TotalSeconds; });
+
+	UE_LOG(LogALS, Log, TEXT("========== Start Dumping Synchronous Loads =========="));
+
+	for (const FLoadRecord* Record : SortedRecords)
+	{
+		UE_LOG(LogALS, Log, TEXT("  %s: %d load(s), total %.2f ms, max %.2f ms%s"), *Record->AssetName, Record->Count,
+			Record->TotalSeconds * 1000.0, Record->MaxSeconds * 1000.0, Record->bExactDuration ? TEXT("") : TEXT(" (upper bound)"));
+
+		for (int32 Depth = 0; Depth < Record->Callstack.Num(); ++Depth)
+		{
+			ANSICHAR Symbol[1024];
+			Symbol[0] = 0;
+			FPlatformStackWalk::ProgramCounterToHumanReadableString(Depth, Record->Callstack[Depth], Symbol, UE_ARRAY_COUNT(Symbol));
+			UE_LOG(LogALS, Log, TEXT("      %s"), ANSI_TO_TCHAR(Symbol));
+		}
+	}
+
+	UE_LOG(LogALS, Log, TEXT("... %d synchronous loads during gameplay, %d budget violation(s)"), TotalLoadCount, NumBudgetViolations);
+	UE_LOG(LogALS, Log, TEXT("========== Finish Dumping Synchronous Loads =========="));
+}
+
+void FALSSyncLoadDetector::ResetReport()
+{
+	OpenLoad.Reset();
+	Records.Empty();
+	TotalLoadCount = 0;
+	NumBudgetViolations = 0;
+}
+
+FALSSyncLoadDetector::FScopedLoad::FScopedLoad(const FSoftObjectPath& AssetPath)
+{
+	FALSSyncLoadDetector& Detector = Get();
+	if (Detector.ScopedLoadDepth == 0 && Detector.ShouldTrackLoad())
+	{
+		bTracking = true;
+		StartTime = FPlatformTime::Seconds();
+		AssetName = AssetPath.ToString();
+		Detector.CloseOpenLoad(StartTime);
+		Detector.NumScopedPackageLoads = 0;
+	}
+
+	++Detector.ScopedLoadDepth;
+}
+
+FALSSyncLoadDetector::FScopedLoad::~FScopedLoad()
+{
+	FALSSyncLoadDetector& Detector = Get();
+	--Detector.ScopedLoadDepth;
+
+	// Assets which were already resident didn't load any package, nothing hitched
+	if (bTracking && Detector.NumScopedPackageLoads > 0)
+	{
+		FOpenLoad Load;
+		Load.AssetName = AssetName;
+		Load.StartTime = StartTime;
+		Detector.CaptureCallstack(Load);
+		Detector.AddRecord(Load, FPlatformTime::Seconds() - StartTime, true);
+	}
+}
+
+#endif // ALS_WITH_SYNC_LOAD_DETECTOR
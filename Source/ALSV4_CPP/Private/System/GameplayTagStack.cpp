@@ -26,21 +26,10 @@ void FGameplayTagStackContainer::AddStack(FGameplayTag Tag, int32 StackCount)
 
 	if (StackCount > 0)
 	{
-		for (FGameplayTagStack& Stack : Stacks)
+		if (AddStackInternal(Tag, StackCount))
 		{
-			if (Stack.Tag == Tag)
-			{
-				const int32 NewCount = Stack.StackCount + StackCount;
-				Stack.StackCount = NewCount;
-				TagToCountMap[Tag] = NewCount;
-				MarkItemDirty(Stack);
-				return;
-			}
+			MarkArrayDirty();
 		}
-
-		FGameplayTagStack& NewStack = Stacks.Emplace_GetRef(Tag, StackCount);
-		MarkItemDirty(NewStack);
-		TagToCountMap.Add(Tag, StackCount);
 	}
 }
 
@@ -55,28 +44,145 @@ void FGameplayTagStackContainer::RemoveStack(FGameplayTag Tag, int32 StackCount)
 	//@TODO: Should we error if you try to remove a stack that doesn't exist or has a smaller count?
 	if (StackCount > 0)
 	{
-		for (auto It = Stacks.CreateIterator(); It; ++It)
+		if (RemoveStackInternal(Tag, StackCount))
+		{
+			MarkArrayDirty();
+		}
+	}
+}
+
+void FGameplayTagStackContainer::AddStacks(const TMap<FGameplayTag, int32>& TagStackCounts)
+{
+	bool bAnyChanged = false;
+	for (const TPair<FGameplayTag, int32>& Pair : TagStackCounts)
+	{
+		if (!Pair.Key.IsValid())
+		{
+			FFrame::KismetExecutionMessage(TEXT("An invalid tag was passed to AddStacks"), ELogVerbosity::Warning);
+			continue;
+		}
+
+		if (Pair.Value > 0)
+		{
+			bAnyChanged |= AddStackInternal(Pair.Key, Pair.Value);
+		}
+	}
+
+	if (bAnyChanged)
+	{
+		MarkArrayDirty();
+	}
+}
+
+void FGameplayTagStackContainer::RemoveStacks(const TMap<FGameplayTag, int32>& TagStackCounts)
+{
+	bool bAnyChanged = false;
+	for (const TPair<FGameplayTag, int32>& Pair : TagStackCounts)
+	{
+		if (!Pair.Key.IsValid())
+		{
+			FFrame::KismetExecutionMessage(TEXT("An invalid tag was passed to RemoveStacks"), ELogVerbosity::Warning);
+			continue;
+		}
+
+		if (Pair.Value > 0)
+		{
+			bAnyChanged |= RemoveStackInternal(Pair.Key, Pair.Value);
+		}
+	}
+
+	if (bAnyChanged)
+	{
+		MarkArrayDirty();
+	}
+}
+
+int32 FGameplayTagStackContainer::FindStackIndex(FGameplayTag Tag)
+{
+	if (bStackIndicesStale)
+	{
+		RebuildStackIndices();
+	}
+
+	const int32* Index = TagToIndexMap.Find(Tag);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void FGameplayTagStackContainer::RebuildStackIndices()
+{
+	TagToIndexMap.Reset();
+	for (int32 Index = 0; Index < Stacks.Num(); ++Index)
+	{
+		TagToIndexMap.Add(Stacks[Index].Tag, Index);
+	}
+	bStackIndicesStale = false;
+}
+
+bool FGameplayTagStackContainer::AddStackInternal(FGameplayTag Tag, int32 StackCount)
+{
+	const int32 ExistingIndex = FindStackIndex(Tag);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		// Bumping the item key is enough for the delta serializer to pick the change up,
+		// the caller marks the array dirty once for all changed items
+		FGameplayTagStack& Stack = Stacks[ExistingIndex];
+		const int32 NewCount = Stack.StackCount + StackCount;
+		Stack.StackCount = NewCount;
+		TagToCountMap[Tag] = NewCount;
+		if (Stack.ReplicationID == INDEX_NONE)
+		{
+			MarkItemDirty(Stack);
+		}
+		else
 		{
-			FGameplayTagStack& Stack = *It;
-			if (Stack.Tag == Tag)
-			{
-				if (Stack.StackCount <= StackCount)
-				{
-					It.RemoveCurrent();
-					TagToCountMap.Remove(Tag);
-					MarkArrayDirty();
-				}
-				else
-				{
-					const int32 NewCount = Stack.StackCount - StackCount;
-					Stack.StackCount = NewCount;
-					TagToCountMap[Tag] = NewCount;
-					MarkItemDirty(Stack);
-				}
-				return;
-			}
+			++Stack.ReplicationKey;
 		}
+		return true;
 	}
+
+	// New items need a replication ID, which only MarkItemDirty hands out
+	const int32 NewIndex = Stacks.Emplace(Tag, StackCount);
+	MarkItemDirty(Stacks[NewIndex]);
+	TagToIndexMap.Add(Tag, NewIndex);
+	TagToCountMap.Add(Tag, StackCount);
+	return false;
+}
+
+bool FGameplayTagStackContainer::RemoveStackInternal(FGameplayTag Tag, int32 StackCount)
+{
+	const int32 Index = FindStackIndex(Tag);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FGameplayTagStack& Stack = Stacks[Index];
+	if (Stack.StackCount <= StackCount)
+	{
+		// Order of the replicated array doesn't matter, swap the last stack into the hole
+		TagToIndexMap.Remove(Tag);
+		TagToCountMap.Remove(Tag);
+		Stacks.RemoveAtSwap(Index, 1, false);
+		if (Stacks.IsValidIndex(Index))
+		{
+			TagToIndexMap[Stacks[Index].Tag] = Index;
+		}
+	}
+	else
+	{
+		const int32 NewCount = Stack.StackCount - StackCount;
+		Stack.StackCount = NewCount;
+		TagToCountMap[Tag] = NewCount;
+		if (Stack.ReplicationID == INDEX_NONE)
+		{
+			MarkItemDirty(Stack);
+		}
+		else
+		{
+			++Stack.ReplicationKey;
+		}
+	}
+	return true;
 }
 
 void FGameplayTagStackContainer::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
@@ -86,6 +192,9 @@ void FGameplayTagStackContainer::PreReplicatedRemove(const TArrayView<int32> Rem
 		const FGameplayTag Tag = Stacks[Index].Tag;
 		TagToCountMap.Remove(Tag);
 	}
+
+	// The removed items get compacted out of Stacks after this call
+	bStackIndicesStale = true;
 }
 
 void FGameplayTagStackContainer::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
@@ -94,6 +203,10 @@ void FGameplayTagStackContainer::PostReplicatedAdd(const TArrayView<int32> Added
 	{
 		const FGameplayTagStack& Stack = Stacks[Index];
 		TagToCountMap.Add(Stack.Tag, Stack.StackCount);
+		if (!bStackIndicesStale)
+		{
+			TagToIndexMap.Add(Stack.Tag, Index);
+		}
 	}
 }
 
@@ -105,5 +218,3 @@ void FGameplayTagStackContainer::PostReplicatedChange(const TArrayView<int32> Ch
 		TagToCountMap[Stack.Tag] = Stack.StackCount;
 	}
 }
-
-
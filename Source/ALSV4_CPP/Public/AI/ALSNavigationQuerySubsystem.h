@@ -0,0 +1,58 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NavigationSystem.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ALSNavigationQuerySubsystem.generated.h"
+
+DECLARE_DELEGATE_ThreeParams(FALSRandomLocationQueryFinished, uint32 /*QueryId*/, bool /*bSuccess*/,
+                             const FVector& /*Location*/);
+
+/**
+ * Batches random reachable location queries of ALS AI agents.
+ *
+ * Queries are queued and serviced in a per-frame batch limited by ALS.AI.RandomLocationQueriesPerFrame,
+ * so hundreds of wandering agents asking for a new destination in the same frame don't spike it.
+ */
+UCLASS()
+class ALSV4_CPP_API UALSNavigationQuerySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UALSNavigationQuerySubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/** Queues a random reachable location query, the delegate fires once it was serviced. Returns the query id. */
+	uint32 RequestRandomLocation(const AActor* Querier, const FVector& Origin, float Radius,
+	                             TSubclassOf<UNavigationQueryFilter> Filter, FALSRandomLocationQueryFinished OnFinished);
+
+	/** Drops a pending query, its delegate won't be called */
+	void CancelQuery(uint32 QueryId);
+
+private:
+	struct FPendingQuery
+	{
+		uint32 QueryId = 0;
+		TWeakObjectPtr<const AActor> Querier;
+		FVector Origin = FVector::ZeroVector;
+		float Radius = 0.0f;
+		TSubclassOf<UNavigationQueryFilter> Filter;
+		FALSRandomLocationQueryFinished OnFinished;
+	};
+
+	void ServiceQuery(UNavigationSystemV1& NavSys, FPendingQuery& Query);
+
+	TArray<FPendingQuery> PendingQueries;
+
+	uint32 LastQueryId = 0;
+};
@@ -8,6 +8,12 @@
 #include "BehaviorTree/Tasks/BTTask_BlackboardBase.h"
 #include "ALS_BTTask_GetRandomLocation.generated.h"
 
+struct FALSGetRandomLocationMemory
+{
+	/** Id of the pending navigation query, zero if none */
+	uint32 QueryId = 0;
+};
+
 /** Picks a random location reachable through NavMesh within the Max Distance from the Owning Pawn's current location and assigns it to the specified Blackboard Key. */
 UCLASS(Category=ALS, meta=(DisplayName = "Get Random Location"))
 class ALSV4_CPP_API UALS_BTTask_GetRandomLocation : public UBTTask_BlackboardBase
@@ -25,6 +31,20 @@ public:
 	UPROPERTY(Category = Navigation, EditAnywhere)
 	TSubclassOf<UNavigationQueryFilter> Filter = nullptr;
 
+	/** Queue the query in UALSNavigationQuerySubsystem and finish latently, instead of querying the NavMesh right away. */
+	UPROPERTY(Category = Navigation, EditAnywhere)
+	bool bAsyncQuery = true;
+
 	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+	virtual void OnTaskFinished(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory,
+	                            EBTNodeResult::Type TaskResult) override;
+	virtual uint16 GetInstanceMemorySize() const override;
 	virtual FString GetStaticDescription() const override;
+
+private:
+	EBTNodeResult::Type ExecuteSyncQuery(UBehaviorTreeComponent& OwnerComp, APawn* Pawn);
+
+	void OnQueryFinished(uint32 QueryId, bool bSuccess, const FVector& Location,
+	                     TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp);
 };
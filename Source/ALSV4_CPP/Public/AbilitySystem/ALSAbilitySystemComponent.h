@@ -15,6 +15,13 @@ struct FGameplayAbilitySpec;
 
 ALSV4_CPP_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Gameplay_AbilityInputBlocked);
 
+/** Activation required and blocked tags of an ability class, merged with the tag relationship mapping expansion */
+struct FALSAbilityActivationRequirements
+{
+	FGameplayTagContainer RequiredTags;
+	FGameplayTagContainer BlockedTags;
+};
+
 /**
  * UALSAbilitySystemComponent
  *
@@ -46,12 +53,18 @@ public:
 	void ProcessAbilityInput(float DeltaTime, bool bGamePaused);
 	void ClearAbilityInput();
 
+	/** Rebuilds the input tag and spec index lookups, needed if DynamicAbilityTags of a granted spec were changed */
+	void RebuildAbilityInputIndex();
+
+	virtual bool ShouldDoServerAbilityRPCBatch() const override { return true; }
+
 	bool IsActivationGroupBlocked(EALSAbilityActivationGroup Group) const;
 	void AddAbilityToActivationGroup(EALSAbilityActivationGroup Group, UALSGameplayAbility* ALSAbility);
 	void RemoveAbilityFromActivationGroup(EALSAbilityActivationGroup Group, UALSGameplayAbility* ALSAbility);
 	void CancelActivationGroupAbilities(EALSAbilityActivationGroup Group, UALSGameplayAbility* IgnoreALSAbility, bool bReplicateCancelAbility);
 
 	// Uses a gameplay effect to add the specified dynamic granted tag.
+	// If the effect is a plain infinite, non-stacking tag grant, the authority adds a replicated loose tag instead.
 	void AddDynamicTagGameplayEffect(const FGameplayTag& Tag);
 
 	// Removes all active instances of the gameplay effect that was used to add the specified dynamic granted tag.
@@ -66,6 +79,9 @@ public:
 	/** Looks at ability tags and gathers additional required and blocking tags */
 	void GetAdditionalActivationTagRequirements(const FGameplayTagContainer& AbilityTags, FGameplayTagContainer& OutActivationRequired, FGameplayTagContainer& OutActivationBlocked) const;
 
+	/** Returns the activation requirements of the ability's class including the tag relationship expansion, built once per class */
+	const FALSAbilityActivationRequirements& GetActivationRequirements(const UALSGameplayAbility& Ability) const;
+
 protected:
 
 	void TryActivateAbilitiesOnSpawn();
@@ -73,6 +89,15 @@ protected:
 	virtual void AbilitySpecInputPressed(FGameplayAbilitySpec& Spec) override;
 	virtual void AbilitySpecInputReleased(FGameplayAbilitySpec& Spec) override;
 
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+
+	/** Same as FindAbilitySpecFromHandle, but resolves the handle through the cached spec index first */
+	FGameplayAbilitySpec* FindAbilitySpecFromHandleCached(FGameplayAbilitySpecHandle Handle);
+
+	void AddToAbilityInputIndex(const FGameplayAbilitySpec& AbilitySpec);
+	void RemoveFromAbilityInputIndex(const FGameplayAbilitySpec& AbilitySpec);
+
 	virtual void NotifyAbilityActivated(const FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability) override;
 	virtual void NotifyAbilityFailed(const FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability, const FGameplayTagContainer& FailureReason) override;
 	virtual void NotifyAbilityEnded(FGameplayAbilitySpecHandle Handle, UGameplayAbility* Ability, bool bWasCancelled) override;
@@ -101,4 +126,37 @@ protected:
 
 	// Number of abilities running in each activation group.
 	int32 ActivationGroupCounts[(uint8)EALSAbilityActivationGroup::MAX];
+
+	// Input tag (any of the spec's dynamic ability tags) to the handles of the specs bound to it.
+	TMultiMap<FGameplayTag, FGameplayAbilitySpecHandle> InputTagToSpecHandles;
+
+	// Last known index of each spec in ActivatableAbilities.Items, validated on use since removals reorder the array.
+	TMap<FGameplayAbilitySpecHandle, int32> SpecHandleToIndex;
+
+	// Activation requirements per ability class, cleared whenever the tag relationship mapping changes.
+	mutable TMap<TObjectKey<UClass>, FALSAbilityActivationRequirements> ActivationRequirementsCache;
+
+	// Resolves UALSGameData::DynamicTagGameplayEffect once and prepares the spec template and removal query.
+	bool CacheDynamicTagGameplayEffect();
+
+	bool MatchesDynamicTagEffect(const FActiveGameplayEffect& Effect) const;
+
+	UPROPERTY(Transient)
+	TSubclassOf<UGameplayEffect> DynamicTagGameplayEffect;
+
+	// Outgoing spec copied for every dynamic tag, rebuilt when the avatar changes. Only built when the effect captures no attributes.
+	FGameplayEffectSpecHandle DynamicTagSpecTemplate;
+
+	bool bDynamicTagSpecReusable = false;
+
+	// Query matching dynamic tag effects granting DynamicTagToRemove.
+	FGameplayEffectQuery DynamicTagRemovalQuery;
+
+	FGameplayTag DynamicTagToRemove;
+
+	// True if the dynamic tag effect only grants its tag forever, so replicated loose tags behave the same.
+	bool bDynamicTagsAsLooseTags = false;
+
+	// How often each dynamic tag was granted as a loose tag by this component, all of them are removed together.
+	TMap<FGameplayTag, int32> LooseDynamicTagGrantCounts;
 };
@@ -37,6 +37,15 @@ struct FALSAbilityTagRelationship
 };
 
 
+/** Pre-merged relationship containers for a single ability tag, including the relationships of all its parent tags */
+struct FALSCompiledAbilityTagRelationship
+{
+	FGameplayTagContainer AbilityTagsToBlock;
+	FGameplayTagContainer AbilityTagsToCancel;
+	FGameplayTagContainer ActivationRequiredTags;
+	FGameplayTagContainer ActivationBlockedTags;
+};
+
 /** Mapping of how ability tags block or cancel other abilities */
 UCLASS()
 class UALSAbilityTagRelationshipMapping : public UDataAsset
@@ -49,6 +58,13 @@ private:
 	TArray<FALSAbilityTagRelationship> AbilityTagRelationships;
 
 public:
+	//~UObject interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~End of UObject interface
+
 	/** Given a set of ability tags, parse the tag relationship and fill out tags to block and cancel */
 	void GetAbilityTagsToBlockAndCancel(const FGameplayTagContainer& AbilityTags, FGameplayTagContainer* OutTagsToBlock, FGameplayTagContainer* OutTagsToCancel) const;
 
@@ -57,4 +73,19 @@ public:
 
 	/** Returns true if the specified ability tags are canceled by the passed in action tag */
 	bool IsAbilityCancelledByTag(const FGameplayTagContainer& AbilityTags, const FGameplayTag& ActionTag) const;
+
+private:
+	/** Builds the lookup tables from AbilityTagRelationships */
+	void CompileRelationships() const;
+
+	/** Finds the merged relationships that apply to an ability owning the given tag */
+	const FALSCompiledAbilityTagRelationship* FindCompiledRelationship(const FGameplayTag& AbilityTag) const;
+
+	/** Relationship tags and all their child tags, mapped to the merged relationships of the tag and its parents */
+	mutable TMap<FGameplayTag, FALSCompiledAbilityTagRelationship> CompiledRelationships;
+
+	/** Exact relationship tag to the merged tags it cancels, used by IsAbilityCancelledByTag */
+	mutable TMap<FGameplayTag, FGameplayTagContainer> CompiledCancelTagsByExactTag;
+
+	mutable bool bRelationshipsCompiled = false;
 };
@@ -40,14 +40,73 @@ struct FGlobalAppliedEffectList
 	void RemoveFromAll();
 };
 
+UENUM()
+enum class EALSGlobalOperationType : uint8
+{
+	Apply,
+	Remove
+};
+
+/** Application or removal of one global ability/effect, spread over several frames */
+USTRUCT()
+struct FALSPendingGlobalOperation
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	EALSGlobalOperationType Type = EALSGlobalOperationType::Apply;
+
+	// Exactly one of these is set
+	UPROPERTY()
+	TSubclassOf<UGameplayAbility> Ability;
+
+	UPROPERTY()
+	TSubclassOf<UGameplayEffect> Effect;
+
+	// ASCs to process, snapshot of the registry for applications
+	UPROPERTY()
+	TArray<TWeakObjectPtr<UALSAbilitySystemComponent>> Targets;
+
+	// Handles to remove, parallel to Targets for removals
+	UPROPERTY()
+	TArray<FGameplayAbilitySpecHandle> AbilityHandles;
+
+	UPROPERTY()
+	TArray<FActiveGameplayEffectHandle> EffectHandles;
+
+	int32 NextTarget = 0;
+
+	UClass* GetOperationClass() const { return Ability ? Ability.Get() : Effect.Get(); }
+
+	bool IsFinished() const { return NextTarget >= Targets.Num(); }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FALSGlobalOperationProgressSignature, UClass*, AbilityOrEffectClass, bool, bRemoving, int32, NumProcessed, int32, NumTotal);
+
+/**
+ * Applies abilities and effects to every registered ASC.
+ *
+ * Applications and removals are queued and processed in time slices, ALS.GlobalAbilitySystem.OperationsPerFrame
+ * ASCs per frame, so a global buff on a crowded server doesn't land in a single frame. Newly registered ASCs
+ * still get every global ability/effect right away. A removal requested while the application of the same class
+ * is still pending (or vice versa) is coalesced into the pending operation.
+ */
 UCLASS()
-class UALSGlobalAbilitySystem : public UWorldSubsystem
+class UALSGlobalAbilitySystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
 public:
 	UALSGlobalAbilitySystem();
 
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual bool IsTickable() const override;
+
+	virtual TStatId GetStatId() const override;
+
 	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category="ALS")
 	void ApplyAbilityToAll(TSubclassOf<UGameplayAbility> Ability);
 
@@ -66,6 +125,35 @@ public:
 	/** Removes an ASC from the global system, along with any active global effects/abilities. */
 	void UnregisterASC(UALSAbilitySystemComponent* ASC);
 
+	/**
+	 * Stops the pending application/removal of an ability or effect class. ASCs which were already processed keep
+	 * their state, the remaining ones are left as they are. Applying the class again after a cancelled application
+	 * queues the ASCs which didn't get it. Returns false if nothing was pending for the class.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "ALS")
+	bool CancelPendingOperation(UClass* AbilityOrEffectClass);
+
+	/** Returns true if an application or removal of the class is still being processed */
+	UFUNCTION(BlueprintPure, Category = "ALS")
+	bool HasPendingOperation(UClass* AbilityOrEffectClass) const;
+
+	/** Called every frame a queued operation made progress, and once more when it finished */
+	UPROPERTY(BlueprintAssignable, Category = "ALS")
+	FALSGlobalOperationProgressSignature OnOperationProgress;
+
+private:
+	int32 FindPendingOperation(const UClass* AbilityOrEffectClass) const;
+
+	/** Processes targets of the operation until the budget runs out */
+	void ProcessOperation(FALSPendingGlobalOperation& Operation, int32& Budget);
+
+	/** Moves the applied handles of a class into a queued removal */
+	void QueueRemoval(TSubclassOf<UGameplayAbility> Ability, FGlobalAppliedAbilityList& Entry);
+	void QueueRemoval(TSubclassOf<UGameplayEffect> Effect, FGlobalAppliedEffectList& Entry);
+
+	/** Puts the not yet removed handles of a pending removal back into the applied list */
+	void RestoreRemainingHandles(const FALSPendingGlobalOperation& Operation);
+
 private:
 	UPROPERTY()
 	TMap<TSubclassOf<UGameplayAbility>, FGlobalAppliedAbilityList> AppliedAbilities;
@@ -74,5 +162,9 @@ private:
 	TMap<TSubclassOf<UGameplayEffect>, FGlobalAppliedEffectList> AppliedEffects;
 
 	UPROPERTY()
-	TArray<UALSAbilitySystemComponent*> RegisteredASCs;
+	TSet<UALSAbilitySystemComponent*> RegisteredASCs;
+
+	// Processed in order, at most one operation per class
+	UPROPERTY()
+	TArray<FALSPendingGlobalOperation> PendingOperations;
 };
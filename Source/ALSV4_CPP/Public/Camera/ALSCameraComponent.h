@@ -7,11 +7,15 @@
 #include "ALSCameraComponent.generated.h"
 
 class UALSCameraMode;
+class UALSCameraModeStack;
 
 DECLARE_DELEGATE_RetVal(TSubclassOf<UALSCameraMode>, FALSCameraModeDelegate);
 
 /**
- * 
+ * UALSCameraComponent
+ *
+ *	The base camera component class used by this project. Blends the camera modes pushed on its camera mode stack,
+ *	the top mode is the one DetermineCameraModeDelegate returns each frame.
  */
 UCLASS()
 class ALSV4_CPP_API UALSCameraComponent : public UCameraComponent
@@ -24,7 +28,31 @@ public:
 	// Returns the camera component if one exists on the specified actor.
 	UFUNCTION(BlueprintPure, Category = "ALS|Camera")
 	static UALSCameraComponent* FindCameraComponent(const AActor* Actor) { return (Actor ? Actor->FindComponentByClass<UALSCameraComponent>() : nullptr); }
-	
+
+	// Returns the target actor that the camera is looking at.
+	virtual AActor* GetTargetActor() const { return GetOwner(); }
+
 	// Delegate used to query for the best camera mode.
 	FALSCameraModeDelegate DetermineCameraModeDelegate;
+
+	// Gets the blend weight of the top camera mode and its class
+	void GetBlendInfo(float& OutWeightOfTopLayer, TSubclassOf<UALSCameraMode>& OutTopModeClass) const;
+
+protected:
+
+	//~UActorComponent interface
+	virtual void OnRegister() override;
+	//~End of UActorComponent interface
+
+	//~UCameraComponent interface
+	virtual void GetCameraView(float DeltaTime, FMinimalViewInfo& DesiredView) override;
+	//~End of UCameraComponent interface
+
+	virtual void UpdateCameraModes();
+
+protected:
+
+	// Stack used to blend the camera modes.
+	UPROPERTY()
+	TObjectPtr<UALSCameraModeStack> CameraModeStack;
 };
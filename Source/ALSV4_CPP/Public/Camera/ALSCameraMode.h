@@ -6,11 +6,181 @@
 #include "UObject/Object.h"
 #include "ALSCameraMode.generated.h"
 
+class UALSCameraComponent;
+
 /**
- * 
+ * EALSCameraModeBlendFunction
+ *
+ *	Blend function used for transitioning between camera modes.
  */
-UCLASS()
+UENUM(BlueprintType)
+enum class EALSCameraModeBlendFunction : uint8
+{
+	// Does a simple linear interpolation.
+	Linear,
+
+	// Immediately accelerates, but smoothly decelerates into the target.  Ease amount controlled by the exponent.
+	EaseIn,
+
+	// Smoothly accelerates, but does not decelerate into the target.  Ease amount controlled by the exponent.
+	EaseOut,
+
+	// Smoothly accelerates and decelerates.  Ease amount controlled by the exponent.
+	EaseInOut,
+
+	COUNT	UMETA(Hidden)
+};
+
+/**
+ * FALSCameraModeView
+ *
+ *	View data produced by the camera mode that is used to blend camera modes.
+ */
+struct FALSCameraModeView
+{
+public:
+
+	FALSCameraModeView();
+
+	void Blend(const FALSCameraModeView& Other, float OtherWeight);
+
+public:
+
+	FVector Location;
+	FRotator Rotation;
+	FRotator ControlRotation;
+	float FieldOfView;
+};
+
+/**
+ * UALSCameraMode
+ *
+ *	Base class for all camera modes. Looks from the view point of the target actor, optionally offset along the view.
+ *	Instances are owned and reused by the camera mode stack of a camera component, OnActivation is called
+ *	whenever one is put back on the stack.
+ */
+UCLASS(Abstract, Blueprintable)
 class ALSV4_CPP_API UALSCameraMode : public UObject
 {
 	GENERATED_BODY()
+
+public:
+
+	UALSCameraMode();
+
+	UALSCameraComponent* GetALSCameraComponent() const;
+
+	virtual UWorld* GetWorld() const override;
+
+	AActor* GetTargetActor() const;
+
+	const FALSCameraModeView& GetCameraModeView() const { return View; }
+
+	// Called when this camera mode is activated on the camera mode stack.
+	virtual void OnActivation() {};
+
+	// Called when this camera mode is deactivated on the camera mode stack.
+	virtual void OnDeactivation() {};
+
+	void UpdateCameraMode(float DeltaTime);
+
+	float GetBlendTime() const { return BlendTime; }
+	float GetBlendWeight() const { return BlendWeight; }
+	void SetBlendWeight(float Weight);
+
+protected:
+
+	virtual FVector GetPivotLocation() const;
+	virtual FRotator GetPivotRotation() const;
+
+	virtual void UpdateView(float DeltaTime);
+	virtual void UpdateBlending(float DeltaTime);
+
+protected:
+
+	// View output produced by the camera mode.
+	FALSCameraModeView View;
+
+	// The horizontal field of view (in degrees).
+	UPROPERTY(EditDefaultsOnly, Category = "View", Meta = (UIMin = "5.0", UIMax = "170", ClampMin = "5.0", ClampMax = "170.0"))
+	float FieldOfView;
+
+	// Minimum view pitch (in degrees).
+	UPROPERTY(EditDefaultsOnly, Category = "View", Meta = (UIMin = "-89.9", UIMax = "89.9", ClampMin = "-89.9", ClampMax = "89.9"))
+	float ViewPitchMin;
+
+	// Maximum view pitch (in degrees).
+	UPROPERTY(EditDefaultsOnly, Category = "View", Meta = (UIMin = "-89.9", UIMax = "89.9", ClampMin = "-89.9", ClampMax = "89.9"))
+	float ViewPitchMax;
+
+	// Offset from the pivot, in view space (X forward, Y right, Z up).
+	UPROPERTY(EditDefaultsOnly, Category = "View")
+	FVector ViewOffset;
+
+	// How long it takes to blend in this mode.
+	UPROPERTY(EditDefaultsOnly, Category = "Blending")
+	float BlendTime;
+
+	// Function used for blending.
+	UPROPERTY(EditDefaultsOnly, Category = "Blending")
+	EALSCameraModeBlendFunction BlendFunction;
+
+	// Exponent used by blend functions to control the shape of the curve.
+	UPROPERTY(EditDefaultsOnly, Category = "Blending")
+	float BlendExponent;
+
+	// Linear blend alpha used to determine the blend weight.
+	float BlendAlpha;
+
+	// Blend weight calculated using the blend alpha and function.
+	float BlendWeight;
+};
+
+
+/**
+ * UALSCameraModeStack
+ *
+ *	Stack used for blending camera modes. Keeps one instance per camera mode class, switching modes
+ *	never creates objects once each class has been used, and evaluating the stack doesn't allocate.
+ */
+UCLASS()
+class UALSCameraModeStack : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UALSCameraModeStack();
+
+	void ActivateStack();
+	void DeactivateStack();
+
+	bool IsStackActivate() const { return bIsActive; }
+
+	void PushCameraMode(TSubclassOf<UALSCameraMode> CameraModeClass);
+
+	// Returns false if there is nothing to evaluate
+	bool EvaluateStack(float DeltaTime, FALSCameraModeView& OutCameraModeView);
+
+	// Gets the blend weight of the top camera mode and its class
+	void GetBlendInfo(float& OutWeightOfTopLayer, TSubclassOf<UALSCameraMode>& OutTopModeClass) const;
+
+protected:
+
+	UALSCameraMode* GetCameraModeInstance(TSubclassOf<UALSCameraMode> CameraModeClass);
+
+	void UpdateStack(float DeltaTime);
+	void BlendStack(FALSCameraModeView& OutCameraModeView) const;
+
+protected:
+
+	bool bIsActive;
+
+	// Pool of camera mode instances, one per class
+	UPROPERTY()
+	TArray<TObjectPtr<UALSCameraMode>> CameraModeInstances;
+
+	// Active camera modes, the top of the stack is at index 0
+	UPROPERTY()
+	TArray<TObjectPtr<UALSCameraMode>> CameraModeStack;
 };
@@ -0,0 +1,40 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SceneTypes.h"
+#include "UObject/Interface.h"
+#include "ALSHiddenComponentsProvider.generated.h"
+
+class AActor;
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UALSHiddenComponentsProvider : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * IALSHiddenComponentsProvider
+ *
+ *	Implemented by view targets which decide themselves what to hide when the camera penetrates them.
+ *	The player controller reuses the gathered set for as long as the revision stays the same.
+ */
+class ALSV4_CPP_API IALSHiddenComponentsProvider
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherHiddenComponents(TSet<FPrimitiveComponentId>& OutHiddenComponents) const = 0;
+
+	// Has to change whenever GatherHiddenComponents would gather something else
+	virtual uint32 GetHiddenComponentsRevision() const = 0;
+
+	// Gathers every registered primitive of the actor and the primitives attached to them, unless tagged NoParentAutoHide
+	static void GatherAttachedPrimitives(const AActor& Actor, TSet<FPrimitiveComponentId>& OutHiddenComponents);
+
+	// Changes whenever a primitive of the actor or one attached to it registers, unregisters, attaches or detaches
+	static uint32 ComputeAttachmentRevision(const AActor& Actor);
+};
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "ModularCharacter.h"
+#include "Camera/ALSHiddenComponentsProvider.h"
 #include "Components/TimelineComponent.h"
 #include "Library/ALSCharacterEnumLibrary.h"
 #include "Library/ALSCharacterStructLibrary.h"
@@ -28,7 +29,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRagdollStateChangedSignature, bool,
  * Base character class
  */
 UCLASS(BlueprintType)
-class ALSV4_CPP_API AALSBaseCharacter : public AModularCharacter
+class ALSV4_CPP_API AALSBaseCharacter : public AModularCharacter, public IALSHiddenComponentsProvider
 {
 	GENERATED_BODY()
 
@@ -45,8 +46,14 @@ public:
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void PostInitializeComponents() override;
 
+	virtual void PostRegisterAllComponents() override;
+
+	virtual void PostUnregisterAllComponents() override;
+
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	/** Ragdoll System */
@@ -64,6 +71,17 @@ public:
 	UFUNCTION(BlueprintCallable, Server, Unreliable, Category = "ALS|Ragdoll System")
 	void Server_SetMeshLocationDuringRagdoll(FVector MeshLocation);
 
+	/** Pooling */
+
+	/** Returns the character states to the class defaults and leaves ragdoll without a get up, used when a character is reused */
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character States")
+	virtual void ResetCharacterState();
+
+	/** Parks or wakes the character for UALSCharacterPool. Pooled characters are hidden, don't tick or collide and are not in the character registry */
+	void SetCharacterPooled(bool bPooled);
+
+	bool IsCharacterPooled() const { return bCharacterPooled; }
+
 	/** Character States */
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Character States")
@@ -216,6 +234,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Rotation System")
 	void SetActorLocationAndTargetRotation(FVector NewLocation, FRotator NewRotation);
 
+	FRotator GetTargetRotation() const { return TargetRotation; }
+
+	void SetTargetRotation(const FRotator& NewTargetRotation) { TargetRotation = NewTargetRotation; }
+
+	/** Rotates the character for its movement state. Called from UALSCharacterMovementComponent::PhysicsRotation as part of the move */
+	void UpdateCharacterRotation(float DeltaTime);
+
 	/** Movement System */
 
 	UFUNCTION(BlueprintGetter, Category = "ALS|Movement System")
@@ -294,6 +319,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Camera System")
 	bool CanPlayCameraShake() const;
 
+	virtual void GatherHiddenComponents(TSet<FPrimitiveComponentId>& OutHiddenComponents) const override;
+
+	virtual uint32 GetHiddenComponentsRevision() const override;
+
+	/** Forces the components hidden by a penetrating camera to be gathered again, registration and attachment changes are picked up on their own */
+	UFUNCTION(BlueprintCallable, Category = "ALS|Camera System")
+	void MarkHiddenComponentsDirty() { ++HiddenComponentsRevision; }
+
 	/** Essential Information Getters/Setters */
 
 	UFUNCTION(BlueprintGetter, Category = "ALS|Essential Information")
@@ -651,4 +684,19 @@ protected:
 private:
 	UPROPERTY()
 	TObjectPtr<UALSDebugComponent> ALSDebugComponent = nullptr;
+
+	/** Index of this character inside the world's UALSCharacterRegistry */
+	int32 CharacterRegistryIndex = INDEX_NONE;
+
+	bool bCharacterPooled = false;
+
+	/** Bumped whenever the components hidden by a penetrating camera may have changed */
+	uint32 HiddenComponentsRevision = 0;
+
+	/** Primitives whose attach children are hashed into the hidden components revision */
+	mutable TArray<TWeakObjectPtr<const UPrimitiveComponent>> HiddenComponentsPrimitives;
+
+	/** Component count and revision HiddenComponentsPrimitives was gathered at */
+	mutable int32 HiddenComponentsSourceCount = INDEX_NONE;
+	mutable uint32 HiddenComponentsSourceRevision = 0;
 };
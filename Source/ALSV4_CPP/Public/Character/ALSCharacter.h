@@ -43,6 +43,8 @@ public:
 
 	virtual void RagdollEnd() override;
 
+	virtual void ResetCharacterState() override;
+
 	virtual ECollisionChannel GetThirdPersonTraceParams(FVector& TraceOrigin, float& TraceRadius) override;
 
 	virtual FTransform GetThirdPersonPivotTarget() override;
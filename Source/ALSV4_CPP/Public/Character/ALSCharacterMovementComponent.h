@@ -28,10 +28,15 @@ class ALSV4_CPP_API UALSCharacterMovementComponent : public UCharacterMovementCo
 		virtual void SetMoveFor(ACharacter* Character, float InDeltaTime, FVector const& NewAccel,
 		                        class FNetworkPredictionData_Client_Character& ClientData) override;
 		virtual void PrepMoveFor(class ACharacter* Character) override;
+		virtual void CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC,
+		                         const FVector& OldStartLocation) override;
 
 		// Walk Speed Update
 		uint8 bSavedRequestMovementSettingsChange : 1;
 		EALSGait SavedAllowedGait = EALSGait::Walking;
+
+		// Rotation Update
+		FRotator SavedTargetRotation = FRotator::ZeroRotator;
 	};
 
 	class ALSV4_CPP_API FNetworkPredictionData_Client_My : public FNetworkPredictionData_Client_Character
@@ -48,6 +53,9 @@ class ALSV4_CPP_API UALSCharacterMovementComponent : public UCharacterMovementCo
 	virtual class FNetworkPredictionData_Client* GetPredictionData_Client() const override;
 	virtual void OnMovementUpdated(float DeltaTime, const FVector& OldLocation, const FVector& OldVelocity) override;
 
+	// Rotation Override
+	virtual void PhysicsRotation(float DeltaTime) override;
+
 	// Movement Settings Override
 	virtual void PhysWalking(float deltaTime, int32 Iterations) override;
 	virtual float GetMaxAcceleration() const override;
@@ -0,0 +1,73 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+
+#include "ALSCharacterPool.generated.h"
+
+class AALSBaseCharacter;
+
+USTRUCT()
+struct FALSPooledCharacters
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AALSBaseCharacter>> Characters;
+};
+
+/**
+ * Per-world pool of pre-warmed ALS characters, used by the game mode for respawns.
+ *
+ * Spawning a character constructs its mesh, anim instance and every component from scratch, and destroying it
+ * leaves all of that for the garbage collector. Pooled characters are spawned ahead of time (one per frame),
+ * parked hidden without ticking or collision, and reset to their default ALS state when released, so a respawn
+ * is a teleport and a possess.
+ *
+ * ALS.CharacterPool.PrewarmCount sets how many characters are pre-warmed per class,
+ * ALS.CharacterPool.MaxPerClass how many released characters are kept before they are destroyed instead.
+ */
+UCLASS()
+class ALSV4_CPP_API UALSCharacterPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UALSCharacterPool* Get(const UObject* WorldContextObject);
+
+	/** Spawns characters of the given class over the next frames until the pool holds ALS.CharacterPool.PrewarmCount of them */
+	void PrewarmCharacters(TSubclassOf<AALSBaseCharacter> CharacterClass);
+
+	/** Takes a character of exactly the given class from the pool and wakes it at the transform, or returns nullptr if none is pooled */
+	AALSBaseCharacter* AcquireCharacter(TSubclassOf<AALSBaseCharacter> CharacterClass, const FTransform& Transform);
+
+	/** Unpossesses and resets the character and parks it in the pool, or destroys it if the pool for its class is full */
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character Pool")
+	void ReleaseCharacter(AALSBaseCharacter* Character);
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character Pool")
+	int32 GetNumPooledCharacters(TSubclassOf<AALSBaseCharacter> CharacterClass) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	virtual void Deinitialize() override;
+
+private:
+	void PrewarmNextCharacter();
+
+	AALSBaseCharacter* SpawnPooledCharacter(TSubclassOf<AALSBaseCharacter> CharacterClass);
+
+	UPROPERTY()
+	TMap<TSubclassOf<AALSBaseCharacter>, FALSPooledCharacters> Pools;
+
+	/** Classes still being pre-warmed, in request order */
+	UPROPERTY()
+	TArray<TSubclassOf<AALSBaseCharacter>> PendingPrewarms;
+
+	FTimerHandle PrewarmTimerHandle;
+};
@@ -0,0 +1,73 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ALSCharacterRegistry.generated.h"
+
+class AALSBaseCharacter;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FALSCharacterRegistryChangedSignature, AALSBaseCharacter*);
+
+/**
+ * Per-world registry of every ALS character that has begun play.
+ *
+ * Characters register themselves on BeginPlay and unregister on EndPlay, so systems which need to look at
+ * "all ALS characters" (debug HUD, AI tasks, crowd/significance managers) can iterate this instead of walking
+ * every actor in the world. Registry indices are stable for the lifetime of a registration.
+ */
+UCLASS()
+class ALSV4_CPP_API UALSCharacterRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UALSCharacterRegistry* Get(const UObject* WorldContextObject);
+
+	/** Adds the character to the registry and returns its stable index */
+	int32 RegisterCharacter(AALSBaseCharacter* Character);
+
+	/** Removes the character stored at the given index, if it is still the same character */
+	void UnregisterCharacter(AALSBaseCharacter* Character, int32 RegistryIndex);
+
+	/** Returns the character registered at the given index, or nullptr if the slot is free */
+	AALSBaseCharacter* GetCharacterAtIndex(int32 RegistryIndex) const;
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character Registry")
+	void GetRegisteredCharacters(TArray<AALSBaseCharacter*>& OutCharacters) const;
+
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character Registry")
+	int32 GetNumRegisteredCharacters() const { return Characters.Num(); }
+
+	/** Incremented every time a character is added or removed, cheap way for consumers to detect changes */
+	uint32 GetRegistrySerial() const { return RegistrySerial; }
+
+	/** Calls the given function for every registered character, without any intermediate allocation */
+	template <typename FunctionType>
+	void ForEachCharacter(FunctionType&& Function) const
+	{
+		for (const TWeakObjectPtr<AALSBaseCharacter>& Character : Characters)
+		{
+			if (AALSBaseCharacter* CharacterPtr = Character.Get())
+			{
+				Function(CharacterPtr);
+			}
+		}
+	}
+
+	FALSCharacterRegistryChangedSignature OnCharacterRegistered;
+
+	FALSCharacterRegistryChangedSignature OnCharacterUnregistered;
+
+protected:
+	virtual void Deinitialize() override;
+
+private:
+	/** Sparse storage keeps indices stable while allowing O(1) add/remove */
+	TSparseArray<TWeakObjectPtr<AALSBaseCharacter>> Characters;
+
+	uint32 RegistrySerial = 0;
+};
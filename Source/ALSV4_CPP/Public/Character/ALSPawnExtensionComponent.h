@@ -47,6 +47,9 @@ public:
 
 	void SetPawnData(const UALSPawnData* InPawnData);
 
+	// Clears the pawn data and ability system so the next SetPawnData and possession initialize the pawn again, used when a pawn is reused.
+	void ResetPawnData();
+
 	UFUNCTION(BlueprintPure, Category = "ALS|Pawn")
 	UALSAbilitySystemComponent* GetALSAbilitySystemComponent() const { return AbilitySystemComponent; }
 
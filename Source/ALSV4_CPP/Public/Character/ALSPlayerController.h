@@ -33,6 +33,39 @@ protected:
 
 	void SetupCamera();
 
+	// Input events of the possessed character which a Blueprint may override
+	enum class ECharacterInputEvent : uint8
+	{
+		ForwardMovement,
+		RightMovement,
+		CameraUp,
+		CameraRight,
+		Jump,
+		Sprint,
+		Aim,
+		CameraTap,
+		CameraHeld,
+		Stance,
+		Walk,
+		Ragdoll,
+		VelocityDirection,
+		LookingDirection,
+		Num
+	};
+
+	/** Finds the input events the possessed character doesn't override in Blueprint, those are called natively */
+	void CacheNativeCharacterInputEvents();
+
+	bool IsNativeCharacterInputEvent(ECharacterInputEvent Event) const
+	{
+		return (NativeCharacterInputEvents & (1u << static_cast<uint32>(Event))) != 0;
+	}
+
+	using FInputActionHandler = void (AALSPlayerController::*)(const FInputActionValue&);
+
+	/** Handlers of the ALS input actions by action name, bound as native delegates instead of by UFunction name */
+	static const TMap<FName, FInputActionHandler>& GetNativeInputActionHandlers();
+
 	UFUNCTION()
 	void ForwardMovementAction(const FInputActionValue& Value);
 
@@ -122,4 +155,8 @@ public:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "ALS|Input")
 	TObjectPtr<UInputMappingContext> DebugInputMappingContext = nullptr;
+
+private:
+	// Bit per ECharacterInputEvent
+	uint32 NativeCharacterInputEvents = 0;
 };
@@ -5,11 +5,14 @@
 
 #include "CoreMinimal.h"
 
+#include "DrawDebugHelpers.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Components/ActorComponent.h"
+#include "Library/ALSAnimationStructLibrary.h"
 #include "ALSDebugComponent.generated.h"
 
 class AALSBaseCharacter;
+class UALSDebugSubsystem;
 class USkeletalMesh;
 
 UCLASS(Blueprintable, BlueprintType)
@@ -22,15 +25,15 @@ public:
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "ALS|Debug")
 	void OnPlayerControllerInitialized(APlayerController* Controller);
 
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
 	                           FActorComponentTickFunction* ThisTickFunction) override;
 
-	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
-
-	/** Implemented on BP to update layering colors */
+	/** Implemented on BP to update layering colors, only called when the layer blending values changed */
 	UFUNCTION(BlueprintImplementableEvent, Category = "ALS|Debug")
 	void UpdateColoringSystem();
 
@@ -68,28 +71,28 @@ public:
 	void ToggleDebugMesh();
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
-	void ToggleTraces() { bShowTraces = !bShowTraces; }
+	void ToggleTraces();
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
-	void ToggleDebugShapes() { bShowDebugShapes = !bShowDebugShapes; }
+	void ToggleDebugShapes();
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
-	void ToggleLayerColors() { bShowLayerColors = !bShowLayerColors; }
+	void ToggleLayerColors();
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
 	void ToggleCharacterInfo() { bShowCharacterInfo = !bShowCharacterInfo; }
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
-	bool GetDebugView() { return bDebugView; }
+	bool GetDebugView() const;
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
-	bool GetShowTraces() { return bShowTraces; }
+	bool GetShowTraces() const;
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
-	bool GetShowDebugShapes() { return bShowDebugShapes; }
+	bool GetShowDebugShapes() const;
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
-	bool GetShowLayerColors() { return bShowLayerColors; }
+	bool GetShowLayerColors() const;
 
 	UFUNCTION(BlueprintCallable, Category = "ALS|Debug")
 	void FocusedDebugCharacterCycle(bool bValue);
@@ -98,6 +101,8 @@ public:
 	// which are derived from Engine/Private/KismetTraceUtils.h.
 	// Sadly the functions are private, which was the reason
 	// why there reimplemented here.
+	// Shapes are buffered in the world's UALSDebugSubsystem and drawn in one batch per frame,
+	// the functions do nothing in Test/Shipping builds.
 	static void DrawDebugLineTraceSingle(const UWorld* World,
 	                                     const FVector& Start,
 	                                     const FVector& End,
@@ -133,6 +138,11 @@ public:
 protected:
 	void DetectDebuggableCharactersInWorld();
 
+	/** Called when the world's debug toggles change, enables the tick only while it has work to do */
+	void RefreshDebugState();
+
+	void UpdateLayerColors();
+
 public:
 	UPROPERTY(BlueprintReadOnly, Category = "ALS|Debug")
 	TObjectPtr<AALSBaseCharacter> OwnerCharacter;
@@ -155,15 +165,21 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "ALS|Debug")
 	TObjectPtr<AALSBaseCharacter> DebugFocusCharacter = nullptr;
 private:
-	static bool bDebugView;
+	/** Per-world debug state, null in Test/Shipping builds */
+	UPROPERTY()
+	TObjectPtr<UALSDebugSubsystem> DebugSubsystem = nullptr;
 
-	static bool bShowTraces;
+	FDelegateHandle DebugStateChangedHandle;
 
-	static bool bShowDebugShapes;
+	bool bNeedsColorReset = false;
 
-	static bool bShowLayerColors;
+	/** Layer blending values the coloring system was last updated with */
+	FALSAnimGraphLayerBlending LastPushedLayerBlending;
 
-	bool bNeedsColorReset = false;
+	bool bHasPushedLayerBlending = false;
+
+	/** True if a Blueprint subclass implements Event Tick, the component then keeps ticking without a visualization */
+	bool bHasBlueprintTick = false;
 
 	bool bDebugMeshVisible = false;
 
@@ -173,4 +189,7 @@ private:
 	/// Stores the index, which is used to select the next focused debug ALSBaseCharacter.
 	/// If no characters where found during BeginPlay the value should be set to INDEX_NONE.
 	int32 FocusedDebugCharacterIndex = INDEX_NONE;
+
+	/// Registry serial the AvailableDebugCharacters list was built from, used to skip redundant rebuilds.
+	uint32 CachedRegistrySerial = MAX_uint32;
 };
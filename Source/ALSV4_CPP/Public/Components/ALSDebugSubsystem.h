@@ -0,0 +1,101 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/LineBatchComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ALSDebugSubsystem.generated.h"
+
+DECLARE_MULTICAST_DELEGATE(FALSDebugStateChangedSignature);
+
+/**
+ * Per-world ALS debug state and debug draw buffer.
+ *
+ * Holds the debug view / trace / shape / layer color toggles for a single world, so several PIE instances
+ * don't share them. Debug primitives requested through UALSDebugComponent's trace helpers are buffered here
+ * and submitted to the world line batchers once per frame, instead of one DrawDebug* call per primitive.
+ *
+ * Only created in builds with ENABLE_DRAW_DEBUG, never exists in Test/Shipping.
+ */
+UCLASS()
+class ALSV4_CPP_API UALSDebugSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UALSDebugSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	/** Debug toggles */
+
+	bool GetDebugView() const { return bDebugView; }
+
+	void SetDebugView(bool bValue) { SetDebugFlag(bDebugView, bValue); }
+
+	bool GetShowTraces() const { return bShowTraces; }
+
+	void SetShowTraces(bool bValue) { SetDebugFlag(bShowTraces, bValue); }
+
+	bool GetShowDebugShapes() const { return bShowDebugShapes; }
+
+	void SetShowDebugShapes(bool bValue) { SetDebugFlag(bShowDebugShapes, bValue); }
+
+	bool GetShowLayerColors() const { return bShowLayerColors; }
+
+	void SetShowLayerColors(bool bValue) { SetDebugFlag(bShowLayerColors, bValue); }
+
+	/** True if any debug visualization which needs a per-frame update is active */
+	bool IsAnyVisualizationActive() const { return bShowDebugShapes || bShowLayerColors; }
+
+	/** Broadcast whenever one of the debug toggles changes */
+	FALSDebugStateChangedSignature OnDebugStateChanged;
+
+	/** Buffered debug primitives, same lifetime semantics as DrawDebugLine & co. */
+
+	void AddLine(const FVector& Start, const FVector& End, const FColor& Color, bool bPersistent, float LifeTime,
+	             float Thickness = 0.0f);
+
+	void AddPoint(const FVector& Position, float Size, const FColor& Color, bool bPersistent, float LifeTime);
+
+	void AddCapsule(const FVector& Center, float HalfHeight, float Radius, const FQuat& Rotation, const FColor& Color,
+	                bool bPersistent, float LifeTime);
+
+	/** Submits every buffered primitive to the world line batchers in one go */
+	void FlushDebugDraw();
+
+private:
+	void SetDebugFlag(bool& bFlag, bool bValue);
+
+	void AddArc(const FVector& Base, const FVector& X, const FVector& Y, float Radius, int32 NumSides, float Angle,
+	            const FColor& Color, bool bPersistent, float LifeTime);
+
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	bool bDebugView = false;
+
+	bool bShowTraces = false;
+
+	bool bShowDebugShapes = false;
+
+	bool bShowLayerColors = false;
+
+	/** Lines & points for the per-frame line batcher */
+	TArray<FBatchedLine> PendingLines;
+
+	TArray<FBatchedPoint> PendingPoints;
+
+	/** Lines & points for the persistent line batcher (persistent or with a lifetime) */
+	TArray<FBatchedLine> PendingPersistentLines;
+
+	TArray<FBatchedPoint> PendingPersistentPoints;
+
+	FDelegateHandle PostActorTickHandle;
+};
@@ -39,4 +39,8 @@ public:
 	// List of Game Feature Plugins this experience wants to have active
 	UPROPERTY(EditAnywhere, Category="Feature Dependencies")
 	TArray<FString> GameFeaturesToEnable;
+
+	// Asset bundles streamed in once the experience has loaded, without holding it up
+	UPROPERTY(EditAnywhere, Category="Preloading")
+	TArray<FName> PreloadBundles;
 };
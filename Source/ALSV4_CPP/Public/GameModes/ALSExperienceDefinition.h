@@ -50,4 +50,12 @@ public:
 	// List of additional action sets to compose into this experience
 	UPROPERTY(EditDefaultsOnly, Category=Gameplay)
 	TArray<TObjectPtr<UALSExperienceActionSet>> ActionSets;
+
+	// Asset bundles streamed in once this experience has loaded, without holding it up
+	UPROPERTY(EditDefaultsOnly, Category=Preloading)
+	TArray<FName> PreloadBundles;
+
+	// Experience likely to be played after this one, preloaded in the background unless the experience manager got a hint
+	UPROPERTY(EditDefaultsOnly, Category=Preloading, meta=(AllowedTypes="ALSExperienceDefinition"))
+	FPrimaryAssetId LikelyNextExperience;
 };
@@ -4,10 +4,46 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/EngineSubsystem.h"
+#include "UObject/PrimaryAssetId.h"
 #include "ALSExperienceManager.generated.h"
 
+class AGameStateBase;
+class UALSExperienceDefinition;
+class UGameFeatureAction;
+struct FActorsInitializedParams;
+struct FStreamableHandle;
+
+/** What an experience left loaded and registered when its world went away during travel */
+USTRUCT()
+struct FALSExperienceTransitionState
+{
+	GENERATED_BODY()
+
+	// Game feature plugins the experience activated
+	UPROPERTY()
+	TArray<FString> GameFeaturePluginURLs;
+
+	// Actions that were deactivated in the old world but are still registered and loaded
+	UPROPERTY()
+	TArray<TObjectPtr<UGameFeatureAction>> RegisteredActions;
+
+	// Primary assets whose bundles the experience loaded, and which bundles
+	UPROPERTY()
+	TArray<FPrimaryAssetId> BundleAssets;
+
+	UPROPERTY()
+	TArray<FName> Bundles;
+};
+
 /**
  * Manager for experiences - primarily for arbitration between multiple PIE sessions
+ *
+ * Also carries the state of an experience across map travel, so the next experience only loads, activates,
+ * deactivates and unloads what differs between the two instead of tearing everything down. The state and the
+ * preloads are kept per world context, so PIE sessions side by side don't release each other's experiences.
+ *
+ * Once an experience has loaded, its preload bundles and the likely next experience are streamed in
+ * in the background within ALS.Experience.PreloadBudgetMB, whatever the next experience doesn't use is evicted.
  */
 UCLASS(MinimalAPI)
 class UALSExperienceManager : public UEngineSubsystem
@@ -25,7 +61,70 @@ public:
 	static bool RequestToDeactivatePlugin(const FString PluginURL) { return true; }
 #endif
 
+	/** Keeps the outgoing experience's plugins, registered actions and bundles alive until the next experience of the world context is known */
+	void StashOutgoingExperience(FName WorldContextHandle, FALSExperienceTransitionState&& OutgoingState);
+
+	/**
+	 * Releases everything of the world context's stashed experience the incoming one doesn't share: deactivates plugins,
+	 * unregisters actions and unloads bundles. Returns the shared actions, which are still registered and loaded.
+	 */
+	void ResolveTransition(FName WorldContextHandle, const TArray<FString>& IncomingPluginURLs, const TArray<UGameFeatureAction*>& IncomingActions,
+		const TArray<FPrimaryAssetId>& IncomingBundleAssets, TSet<UGameFeatureAction*>& OutRetainedActions);
+
+	/** Fully releases the experience stashed for the world context */
+	void FlushPendingTransition(FName WorldContextHandle);
+
+	/** Hints at the experience to be played next (e.g. from a playlist), preloaded instead of the definition's LikelyNextExperience */
+	ALSV4_CPP_API void SetNextExperienceHint(const FPrimaryAssetId& ExperienceId);
+
+	/** Starts streaming in the preload bundles of a loaded experience and the experience likely to follow it */
+	void StartPreloading(FName WorldContextHandle, const UALSExperienceDefinition* LoadedExperience, const TArray<FName>& ExperienceBundles);
+
+	/** Unloads preloaded assets the incoming experience doesn't use and cancels preloads still in flight */
+	void EvictUnusedPreloads(FName WorldContextHandle, const TArray<FPrimaryAssetId>& IncomingBundleAssets);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
 private:
+	// Worlds without an experience never resolve the stash of their world context, so it is flushed once their game state is known
+	void HandleWorldInitializedActors(const FActorsInitializedParams& Params);
+	void HandleGameStateSet(AGameStateBase* GameState);
+
+	struct FPreload
+	{
+		FPrimaryAssetId AssetId;
+		TArray<FName> Bundles;
+		int64 EstimatedBytes = 0;
+
+		// Preloads of assets which weren't loaded yet own the primary asset, others only added bundles to it
+		bool bOwnsPrimaryAsset = false;
+
+		TSharedPtr<FStreamableHandle> Handle;
+	};
+
+	// Adds a preload if it fits into the budget
+	FPreload* RequestPreload(FName WorldContextHandle, const FPrimaryAssetId& AssetId, const TArray<FName>& Bundles, bool bOwnsPrimaryAsset);
+
+	// Disk size of the primary asset and the assets its bundles reference directly
+	int64 EstimatePreloadSize(const FPrimaryAssetId& AssetId, const TArray<FName>& Bundles) const;
+
+	void OnNextExperiencePreloaded(FName WorldContextHandle, FPrimaryAssetId ExperienceId, TArray<FName> ExperienceBundles);
+
+	// Preloads by the handle of the world context whose experience started them
+	TMap<FName, TArray<FPreload>> Preloads;
+
+	// The budget is shared by all world contexts
+	int64 PreloadedBytes = 0;
+
+	FPrimaryAssetId NextExperienceHint;
+
+	// Stashed experiences by the handle of the world context they travel in
+	UPROPERTY()
+	TMap<FName, FALSExperienceTransitionState> PendingTransitions;
+
+	FDelegateHandle WorldInitializedActorsHandle;
+
 	// The map of requests to active count for a given game feature plugin
 	// (to allow first in, last out activation management during PIE)
 	TMap<FString, int32> GameFeaturePluginRequestCountMap;
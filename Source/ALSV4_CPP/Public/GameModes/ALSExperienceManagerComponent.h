@@ -6,16 +6,20 @@
 #include "Components/GameStateComponent.h"
 #include "GameFeaturePluginOperationResult.h"
 #include "LoadingProcessInterface.h"
+#include "UObject/PrimaryAssetId.h"
 
 #include "ALSExperienceManagerComponent.generated.h"
 
 class UALSExperienceDefinition;
+class UGameFeatureAction;
+struct FStreamableHandle;
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnALSExperienceLoaded, const UALSExperienceDefinition* /*Experience*/);
 
 enum class EALSExperienceLoadState
 {
 	Unloaded,
+	LoadingDefinition,
 	Loading,
 	LoadingGameFeatures,
 	LoadingChaosTestingDelay,
@@ -67,25 +71,83 @@ public:
 
 private:
 	UFUNCTION()
-	void OnRep_CurrentExperience();
+	void OnRep_CurrentExperienceId();
+
+	// Streams in the definition of CurrentExperienceId, then continues with StartExperienceLoad
+	void StartExperienceDefinitionLoad();
+	void OnExperienceDefinitionLoaded();
 
 	void StartExperienceLoad();
+	void CollectGameFeaturePluginURLs();
+	void GetExperienceActions(TArray<UGameFeatureAction*>& OutActions) const;
 	void OnExperienceLoadComplete();
 	void OnGameFeaturePluginLoadComplete(const UE::GameFeatures::FResult& Result);
 	void OnExperienceFullLoadCompleted();
 
+	// Runs the queued action steps within the frame budget, continuing next frame until all are done
+	void TickActionSteps();
+	void ExecuteActionSteps(double BudgetSeconds);
+	void OnAllActionsActivated();
+	void LogActionTimings() const;
+
 	void OnActionDeactivationCompleted();
 	void OnAllActionsDeactivated();
 
 private:
-	UPROPERTY(ReplicatedUsing=OnRep_CurrentExperience)
+	// Replicated instead of the definition itself, so clients stream the definition in rather than loading it on receive
+	UPROPERTY(ReplicatedUsing=OnRep_CurrentExperienceId)
+	FPrimaryAssetId CurrentExperienceId;
+
+	UPROPERTY(Transient)
 	TObjectPtr<const UALSExperienceDefinition> CurrentExperience;
 
+	// Keeps the experience definition loaded
+	TSharedPtr<FStreamableHandle> ExperienceDefinitionHandle;
+
 	EALSExperienceLoadState LoadState = EALSExperienceLoadState::Unloaded;
 
+	// Plugins load in parallel with the experience's bundles, both have to finish before the actions run
 	int32 NumGameFeaturePluginsLoading = 0;
 	TArray<FString> GameFeaturePluginURLs;
 
+	// Plugins counted with NotifyOfPluginActivation, the only ones EndPlay may release
+	TArray<FString> ActivatedPluginURLs;
+	double ExperienceLoadStartTime = 0.0;
+
+	// Primary assets and bundles requested for this experience
+	TArray<FPrimaryAssetId> LoadedBundleAssets;
+	TArray<FName> LoadedBundles;
+
+	// Actions the previous map's experience left registered and loaded, only activated again
+	TSet<UGameFeatureAction*> RetainedActions;
+
+	enum class EActionPhase : uint8
+	{
+		Registering,
+		Loading,
+		Activating
+	};
+
+	struct FActionStep
+	{
+		UGameFeatureAction* Action;
+		EActionPhase Phase;
+	};
+
+	// Action steps of the experience being activated, spread over as many frames as ALS.Experience.ActionFrameBudgetMs requires
+	TArray<FActionStep> PendingActionSteps;
+	int32 NextActionStep = 0;
+
+	// Last phase each action went through, actions without an entry were never registered. Torn down accordingly in EndPlay.
+	TMap<UGameFeatureAction*, EActionPhase> ActionPhases;
+	FName ActionWorldContextHandle;
+	FTimerHandle ActionStepTimerHandle;
+
+	// Time spent in each action across all of its phases
+	TMap<const UGameFeatureAction*, double> ActionTimings;
+	double ActionStepsStartTime = 0.0;
+	int32 NumActionStepFrames = 0;
+
 	int32 NumObservedPausers = 0;
 	int32 NumExpectedPausers = 0;
 
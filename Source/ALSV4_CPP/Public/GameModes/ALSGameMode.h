@@ -78,6 +78,9 @@ protected:
 	virtual void FailedToRestartPlayer(AController* NewPlayer) override;
 	//~End of AGameModeBase interface
 	
+	// Takes a pre-warmed character for the controller's pawn class from the world's UALSCharacterPool, if one is pooled
+	APawn* AcquirePooledPawn(AController* NewPlayer, const FTransform& SpawnTransform);
+
 	void OnExperienceLoaded(const UALSExperienceDefinition* CurrentExperience);
 	bool IsExperienceLoaded() const;
 
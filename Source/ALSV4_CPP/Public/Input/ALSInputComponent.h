@@ -10,6 +10,15 @@
 #include "Input/ALSMappableConfigPair.h"
 #include "ALSInputComponent.generated.h"
 
+/** Native handler for the input action mapped to an input tag, see UALSInputComponent::BindAllActions */
+template<class UserClass>
+struct TALSNativeInputBinding
+{
+	FGameplayTag InputTag;
+	ETriggerEvent TriggerEvent;
+	void (UserClass::*Func)(const FInputActionValue&);
+};
+
 /**
  * UALSInputComponent
  *
@@ -33,6 +42,10 @@ public:
 	template<class UserClass, typename PressedFuncType, typename ReleasedFuncType>
 	void BindAbilityActions(const UALSInputConfig* InputConfig, UserClass* Object, PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc, TArray<uint32>& BindHandles);
 
+	// Binds the native handlers and all ability actions of a config in one pass
+	template<class UserClass, typename PressedFuncType, typename ReleasedFuncType>
+	void BindAllActions(const UALSInputConfig* InputConfig, UserClass* Object, const TArray<TALSNativeInputBinding<UserClass>>& NativeBindings, PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc, TArray<uint32>& BindHandles, bool bLogIfNotFound = true);
+
 	void RemoveBinds(TArray<uint32>& BindHandles);
 
 	void AddInputConfig(const FLoadedMappableConfigPair& ConfigPair, UEnhancedInputLocalPlayerSubsystem* InputSubsystem);
@@ -55,6 +68,8 @@ void UALSInputComponent::BindAbilityActions(const UALSInputConfig* InputConfig,
 {
 	check(InputConfig);
 
+	BindHandles.Reserve(BindHandles.Num() + InputConfig->AbilityInputActions.Num() * 2);
+
 	for (const FALSInputAction& Action : InputConfig->AbilityInputActions)
 	{
 		if (Action.InputAction && Action.InputTag.IsValid())
@@ -71,3 +86,19 @@ void UALSInputComponent::BindAbilityActions(const UALSInputConfig* InputConfig,
 		}
 	}
 }
+
+template<class UserClass, typename PressedFuncType, typename ReleasedFuncType>
+void UALSInputComponent::BindAllActions(const UALSInputConfig* InputConfig, UserClass* Object, const TArray<TALSNativeInputBinding<UserClass>>& NativeBindings, PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc, TArray<uint32>& BindHandles, bool bLogIfNotFound)
+{
+	check(InputConfig);
+
+	for (const TALSNativeInputBinding<UserClass>& Binding : NativeBindings)
+	{
+		if (const UInputAction* IA = InputConfig->FindNativeInputActionForTag(Binding.InputTag, bLogIfNotFound))
+		{
+			BindAction(IA, Binding.TriggerEvent, Object, Binding.Func);
+		}
+	}
+
+	BindAbilityActions(InputConfig, Object, PressedFunc, ReleasedFunc, BindHandles);
+}
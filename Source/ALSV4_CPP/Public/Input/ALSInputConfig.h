@@ -42,9 +42,25 @@ public:
 
 	UALSInputConfig(const FObjectInitializer& ObjectInitializer);
 
+	//~UObject interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~End of UObject interface
+
 	const UInputAction* FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound = true) const;
 	const UInputAction* FindAbilityInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound = true) const;
 
+private:
+	// Builds the tag lookups from NativeInputActions and AbilityInputActions, the first action listed for a tag wins
+	void RebuildInputActionMaps() const;
+
+	// Lookups of the arrays below, which keep the input actions referenced
+	mutable TMap<FGameplayTag, const UInputAction*> NativeInputActionMap;
+	mutable TMap<FGameplayTag, const UInputAction*> AbilityInputActionMap;
+	mutable bool bInputActionMapsBuilt = false;
+
 public:
 	// List of input actions used by the owner.  These input actions are mapped to a gameplay tag and must be manually bound.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Meta = (TitleProperty = "InputAction"))
@@ -310,6 +310,34 @@ struct FALSAnimGraphLayerBlending
 
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "ALS|Anim Graph - Layer Blending")
 	float EnableHandIK_R = 1.0f;
+
+	bool Equals(const FALSAnimGraphLayerBlending& Other, float Tolerance = KINDA_SMALL_NUMBER) const
+	{
+		return OverlayOverrideState == Other.OverlayOverrideState
+			&& FMath::IsNearlyEqual(EnableAimOffset, Other.EnableAimOffset, Tolerance)
+			&& FMath::IsNearlyEqual(BasePose_N, Other.BasePose_N, Tolerance)
+			&& FMath::IsNearlyEqual(BasePose_CLF, Other.BasePose_CLF, Tolerance)
+			&& FMath::IsNearlyEqual(Arm_L, Other.Arm_L, Tolerance)
+			&& FMath::IsNearlyEqual(Arm_L_Add, Other.Arm_L_Add, Tolerance)
+			&& FMath::IsNearlyEqual(Arm_L_LS, Other.Arm_L_LS, Tolerance)
+			&& FMath::IsNearlyEqual(Arm_L_MS, Other.Arm_L_MS, Tolerance)
+			&& FMath::IsNearlyEqual(Arm_R, Other.Arm_R, Tolerance)
+			&& FMath::IsNearlyEqual(Arm_R_Add, Other.Arm_R_Add, Tolerance)
+			&& FMath::IsNearlyEqual(Arm_R_LS, Other.Arm_R_LS, Tolerance)
+			&& FMath::IsNearlyEqual(Arm_R_MS, Other.Arm_R_MS, Tolerance)
+			&& FMath::IsNearlyEqual(Hand_L, Other.Hand_L, Tolerance)
+			&& FMath::IsNearlyEqual(Hand_R, Other.Hand_R, Tolerance)
+			&& FMath::IsNearlyEqual(Legs, Other.Legs, Tolerance)
+			&& FMath::IsNearlyEqual(Legs_Add, Other.Legs_Add, Tolerance)
+			&& FMath::IsNearlyEqual(Pelvis, Other.Pelvis, Tolerance)
+			&& FMath::IsNearlyEqual(Pelvis_Add, Other.Pelvis_Add, Tolerance)
+			&& FMath::IsNearlyEqual(Spine, Other.Spine, Tolerance)
+			&& FMath::IsNearlyEqual(Spine_Add, Other.Spine_Add, Tolerance)
+			&& FMath::IsNearlyEqual(Head, Other.Head, Tolerance)
+			&& FMath::IsNearlyEqual(Head_Add, Other.Head_Add, Tolerance)
+			&& FMath::IsNearlyEqual(EnableHandIK_L, Other.EnableHandIK_L, Tolerance)
+			&& FMath::IsNearlyEqual(EnableHandIK_R, Other.EnableHandIK_R, Tolerance);
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -104,6 +104,12 @@ protected:
 	void K2_OnEndAutoRun();
 
 	bool bHideViewTargetPawnNextFrame = false;
+
+private:
+	// What UpdateHiddenComponents last hid for a penetrated view target, reused while the view target doesn't change
+	TWeakObjectPtr<const AActor> HiddenComponentsViewTarget;
+	uint32 HiddenComponentsRevision = 0;
+	TSet<FPrimitiveComponentId> CachedHiddenComponents;
 };
 
 
@@ -93,6 +93,14 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category=Teams)
 	void RemoveStatTagStack(FGameplayTag Tag, int32 StackCount);
 
+	// Adds stacks to several tags at once, replicated as a single change
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category=Teams)
+	void AddStatTagStacks(const TMap<FGameplayTag, int32>& TagStackCounts);
+
+	// Removes stacks from several tags at once, replicated as a single change
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category=Teams)
+	void RemoveStatTagStacks(const TMap<FGameplayTag, int32>& TagStackCounts);
+
 	// Returns the stack count of the specified tag (or 0 if the tag is not present)
 	UFUNCTION(BlueprintCallable, Category=Teams)
 	int32 GetStatTagStackCount(FGameplayTag Tag) const;
@@ -94,9 +94,12 @@ protected:
 	TSoftObjectPtr<UALSPawnData> DefaultPawnData;
 
 private:
-	// Flushes the StartupJobs array. Processes all startup work.
+	// Flushes the StartupJobs array. Processes all startup work, starting each job once its prerequisites are done.
 	void DoAllStartupJobs();
 
+	// Starts streaming the game data primary assets, GetGameData picks the result up once loaded
+	void StartLoadingGameData(TSharedPtr<FStreamableHandle>& OutLoadHandle);
+
 	// Sets up the ability system
 	void InitializeAbilitySystem();
 	void InitializeGameplayCueManager();
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Containers/Array.h"
 #include "Containers/UnrealString.h"
 #include "Delegates/Delegate.h"
 #include "Engine/StreamableManager.h"
@@ -19,6 +20,10 @@ struct ALSV4_CPP_API FALSAssetManagerStartupJob
 	FString JobName;
 	float JobWeight;
 	mutable double LastUpdate = 0;
+	mutable double StartTime = 0;
+
+	/** Indices of the startup jobs which have to complete before this one starts */
+	TArray<int32> Prerequisites;
 
 	/** Simple job that is all synchronous */
 	FALSAssetManagerStartupJob(const FString& InJobName, const TFunction<void(const FALSAssetManagerStartupJob&, TSharedPtr<FStreamableHandle>&)>& InJobFunc, float InJobWeight)
@@ -30,6 +35,12 @@ struct ALSV4_CPP_API FALSAssetManagerStartupJob
 	/** Perform actual loading, will return a handle if it created one */
 	TSharedPtr<FStreamableHandle> DoJob() const;
 
+	/** Runs the job function without waiting for the handle it created, so other jobs can run while it streams */
+	TSharedPtr<FStreamableHandle> StartJob() const;
+
+	/** Called once the handle returned by StartJob completed */
+	void FinishJob(const TSharedPtr<FStreamableHandle>& Handle) const;
+
 	void UpdateSubstepProgress(float NewProgress) const
 	{
 		SubstepProgressDelegate.ExecuteIfBound(NewProgress);
@@ -41,7 +52,7 @@ struct ALSV4_CPP_API FALSAssetManagerStartupJob
 		{
 			// StreamableHandle::GetProgress traverses() a large graph and is quite expensive
 			double Now = FPlatformTime::Seconds();
-			if (LastUpdate - Now > 1.0 / 60)
+			if (Now - LastUpdate > 1.0 / 60)
 			{
 				SubstepProgressDelegate.Execute(StreamableHandle->GetProgress());
 				LastUpdate = Now;
@@ -0,0 +1,30 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "ALSCompareStartupTimingsCommandlet.generated.h"
+
+/**
+ * Compares two startup telemetry reports written by FALSStartupTelemetry and flags regressions.
+ *
+ * Usage: -run=ALSCompareStartupTimings [-Baseline=<report.json>] [-Current=<report.json>]
+ *                                      [-Role=<Client|Server>] [-Threshold=<percent>] [-MinDelta=<seconds>]
+ *
+ * Without explicit files the two latest reports of Role (default Client) in Saved/Profiling/ALSStartup are compared.
+ * A job regresses when its wall time grew by more than Threshold percent (default 10) and MinDelta seconds
+ * (default 0.05), or when it does more synchronous loads than before. Returns 1 if anything regressed.
+ */
+UCLASS()
+class UALSCompareStartupTimingsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UALSCompareStartupTimingsCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,89 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Timings and load counters of a single startup job */
+struct ALSV4_CPP_API FALSStartupJobRecord
+{
+	FString JobName;
+
+	// Seconds since the first startup job started
+	double StartSeconds = 0.0;
+
+	double WallSeconds = 0.0;
+
+	int64 BytesLoaded = 0;
+
+	int32 SyncLoadCount = 0;
+
+	int32 PackageCount = 0;
+};
+
+/**
+ * FALSStartupTelemetry
+ *
+ *	Records per-job timings and load counters while UALSAssetManager runs its startup jobs, and writes them
+ *	as CSV and JSON to Saved/Profiling/ALSStartup. Job begin/end are also emitted as Unreal Insights bookmarks.
+ *	Load counters are sampled when a job starts and finishes, jobs running at the same time share them,
+ *	and are compiled out of shipping builds.
+ *	Use the ALSCompareStartupTimings commandlet to compare two reports.
+ */
+class ALSV4_CPP_API FALSStartupTelemetry
+{
+public:
+	// Name of the record summarizing the whole startup
+	static const TCHAR* TotalRecordName;
+
+	FALSStartupTelemetry();
+	~FALSStartupTelemetry();
+
+	void BeginJob(int32 JobIndex, const FString& JobName);
+	void EndJob(int32 JobIndex);
+
+	// Adds the total record and writes the report files (non-shipping builds outside of commandlets only)
+	void Finish();
+
+	const TArray<FALSStartupJobRecord>& GetRecords() const { return Records; }
+
+	// Directory the reports are written to
+	static FString GetReportDirectory();
+
+	// Role the reports of this process are written for, "Client" or "Server"
+	static const TCHAR* GetRole();
+
+	// Returns the JSON reports of the role in the report directory, oldest first
+	static TArray<FString> FindReports(const FString& Role);
+
+	static bool ReadReport(const FString& FilePath, TArray<FALSStartupJobRecord>& OutRecords);
+
+private:
+	struct FSample
+	{
+		double Time = 0.0;
+		int64 Bytes = 0;
+		int32 SyncLoads = 0;
+		int32 Packages = 0;
+	};
+
+	FSample TakeSample() const;
+
+	void WriteReport() const;
+
+	void HandleSyncLoadPackage(const FString& PackageName);
+
+	TArray<FALSStartupJobRecord> Records;
+
+	// Sample taken when each job began, indexed like Records
+	TArray<FSample> JobStartSamples;
+
+	TMap<int32, int32> JobIndexToRecord;
+
+	FSample FirstSample;
+
+	int32 NumSyncLoads = 0;
+
+	FDelegateHandle SyncLoadHandle;
+};
@@ -0,0 +1,106 @@
+// Copyright:       Copyright (C) 2022 Doğa Can Yanıkoğlu
+// Source Code:     https://github.com/dyanikoglu/ALS-Community
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#define ALS_WITH_SYNC_LOAD_DETECTOR !UE_BUILD_SHIPPING
+
+#if ALS_WITH_SYNC_LOAD_DETECTOR
+
+/**
+ * FALSSyncLoadDetector
+ *
+ *	Catches every synchronous package load on the game thread while a game world is playing, records the asset,
+ *	callstack and duration and aggregates them into a hitch report.
+ *
+ *	Enabled with ALS.SyncLoads.Enable 1 or -ALSDetectSyncLoads. ALS.SyncLoads.Dump prints the report,
+ *	ALS.SyncLoads.Reset clears it. Loads going through UALSAssetManager are timed exactly, other loads are only
+ *	seen when they start and are timed until the next synchronous load or the end of the frame, an upper bound.
+ *
+ *	For CI, ALS.SyncLoads.HitchThresholdMs and ALS.SyncLoads.MaxCount turn loads over budget into errors,
+ *	which also fail the automation test running at the time.
+ */
+class ALSV4_CPP_API FALSSyncLoadDetector
+{
+public:
+	static FALSSyncLoadDetector& Get();
+
+	void SetEnabled(bool bEnabled);
+
+	bool IsEnabled() const { return SyncLoadHandle.IsValid(); }
+
+	void DumpReport() const;
+
+	void ResetReport();
+
+	/** Times a synchronous load issued by our own code exactly, loads started inside the scope are attributed to it */
+	struct ALSV4_CPP_API FScopedLoad
+	{
+		explicit FScopedLoad(const FSoftObjectPath& AssetPath);
+		~FScopedLoad();
+
+	private:
+		bool bTracking = false;
+		double StartTime = 0.0;
+		FString AssetName;
+	};
+
+private:
+	static constexpr int32 MaxCallstackDepth = 32;
+
+	struct FOpenLoad
+	{
+		FString AssetName;
+		double StartTime = 0.0;
+		uint64 Callstack[MaxCallstackDepth];
+		uint32 CallstackDepth = 0;
+	};
+
+	struct FLoadRecord
+	{
+		FString AssetName;
+		int32 Count = 0;
+		double TotalSeconds = 0.0;
+		double MaxSeconds = 0.0;
+		bool bExactDuration = true;
+		TArray<uint64> Callstack;
+	};
+
+	bool ShouldTrackLoad() const;
+
+	void CaptureCallstack(FOpenLoad& Load) const;
+
+	void HandleSyncLoadPackage(const FString& PackageName);
+
+	void HandleEndFrame();
+
+	void HandleEnginePreExit();
+
+	void CloseOpenLoad(double EndTime);
+
+	void AddRecord(const FOpenLoad& Load, double Seconds, bool bExactDuration);
+
+	// Keyed by asset name and callstack hash
+	TMap<TPair<FString, uint32>, FLoadRecord> Records;
+
+	TOptional<FOpenLoad> OpenLoad;
+
+	int32 ScopedLoadDepth = 0;
+
+	// Packages loaded inside the outermost scoped load
+	int32 NumScopedPackageLoads = 0;
+
+	int32 TotalLoadCount = 0;
+
+	int32 NumBudgetViolations = 0;
+
+	FDelegateHandle SyncLoadHandle;
+
+	FDelegateHandle EndFrameHandle;
+
+	FDelegateHandle PreExitHandle;
+};
+
+#endif // ALS_WITH_SYNC_LOAD_DETECTOR
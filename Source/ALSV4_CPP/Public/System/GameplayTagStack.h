@@ -65,6 +65,12 @@ public:
 	// Removes a specified number of stacks from the tag (does nothing if StackCount is below 1)
 	void RemoveStack(FGameplayTag Tag, int32 StackCount);
 
+	// Adds stacks to several tags at once, the array is only marked dirty once for the whole batch
+	void AddStacks(const TMap<FGameplayTag, int32>& TagStackCounts);
+
+	// Removes stacks from several tags at once, the array is only marked dirty once for the whole batch
+	void RemoveStacks(const TMap<FGameplayTag, int32>& TagStackCounts);
+
 	// Returns the stack count of the specified tag (or 0 if the tag is not present)
 	int32 GetStackCount(FGameplayTag Tag) const
 	{
@@ -88,6 +94,18 @@ public:
 		return FFastArraySerializer::FastArrayDeltaSerialize<FGameplayTagStack, FGameplayTagStackContainer>(Stacks, DeltaParms, *this);
 	}
 
+private:
+	// Returns the index of the tag's stack in Stacks, or INDEX_NONE
+	int32 FindStackIndex(FGameplayTag Tag);
+
+	void RebuildStackIndices();
+
+	// Adds to the tag's stack, returns true if the array still has to be marked dirty (new stacks dirty it themselves)
+	bool AddStackInternal(FGameplayTag Tag, int32 StackCount);
+
+	// Removes from the tag's stack without marking the array dirty, returns true if anything changed
+	bool RemoveStackInternal(FGameplayTag Tag, int32 StackCount);
+
 private:
 	// Replicated list of gameplay tag stacks
 	UPROPERTY()
@@ -95,6 +113,12 @@ private:
 	
 	// Accelerated list of tag stacks for queries
 	TMap<FGameplayTag, int32> TagToCountMap;
+
+	// Index of each tag's stack in Stacks
+	TMap<FGameplayTag, int32> TagToIndexMap;
+
+	// Set when replication compacted Stacks, indices are rebuilt on the next lookup
+	bool bStackIndicesStale = false;
 };
 
 template<>